@@ -0,0 +1,102 @@
+#include "gtreflect.h"
+#include "Transport.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+Options parseargs(int argc, const char** argv);
+[[nodiscard]] static uint64_t number(const std::string& arg, size_t prefix, uint64_t max) noexcept;
+
+int main(int argc, const char** argv)
+{
+	GTR_ASSERT_OR(argc >= 3, EXIT_FAILURE, "Waiting for at least 2 command line arguments but I got: %d.\n", argc - 1);
+	const Options options = parseargs(argc, argv);
+	if (!options.Batch.empty())
+		return BatchRun(options).Result;
+	else if (options.IsPrebuild)
+		return PrebuildRun(options).Result;
+	else
+		return PostbuildRun(options).Result;
+}
+
+Options parseargs(int argc, const char** argv)
+{
+	Options options;
+	options.Endpoint = Transport::DefaultEndpoint();
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg{ argv[i] };
+		if (arg.substr(0, 5).compare("-post") == 0)
+			options.IsPrebuild = false;
+		else if (arg.substr(0, 5).compare("-dir=") == 0)
+			options.Batch.push_back(arg.substr(5));
+		else if (arg.substr(0, 10).compare("-projects=") == 0)
+		{
+			//Relative directories are relative to the list
+			const std::filesystem::path list = arg.substr(10);
+			std::ifstream input(list);
+			GTR_ASSERT_OR(input.is_open(), options, "Couldn't open list of projects: %s\n", list.string().c_str());
+			std::string line;
+			while (std::getline(input, line))
+			{
+				const size_t start = line.find_first_not_of(" \t");
+				const size_t end = line.find_last_not_of(" \t\r");
+				if (start == std::string::npos || line[start] == '#')
+					continue;
+				options.Batch.push_back((list.parent_path() / line.substr(start, end - start + 1)).string());
+			}
+		}
+		else if (arg.substr(0, 6).compare("-jobs=") == 0)
+			options.Jobs = (unsigned)number(arg, 6, 1024);
+		else if (arg.compare("-registry") == 0)
+			options.Registry = true;
+		else if (arg.substr(0, 10).compare("-endpoint=") == 0)
+			options.Endpoint = arg.substr(10);
+		else if (arg.substr(0, 9).compare("-timeout=") == 0)
+			options.Timeout = std::chrono::milliseconds(number(arg, 9, 3600000));//Up to an hour, the sockets wait on an int of milliseconds
+		else if (arg.compare("-publish") == 0)
+			options.Publish = true;
+		else if (arg.compare("-db") == 0)
+			options.Database = true;
+		else if (arg.compare("-layout") == 0)
+			options.LayoutReport = true;
+		else if (arg.compare("-lint") == 0)
+			options.Lint = true;
+		else if (arg.compare("-nocache") == 0)
+			options.Cache = false;
+		else if (arg.substr(0, 9).compare("-targets=") == 0)
+		{
+			const std::string list = arg.substr(9);
+			for (size_t start = 0, end = 0; start <= list.size(); start = end + 1)
+			{
+				end = std::min(list.find(',', start), list.size());
+				if (end > start)
+					options.Targets.push_back(list.substr(start, end - start));
+			}
+		}
+		else if (arg.substr(0, 4).compare("-pre") != 0) { GTR_ASSERT_OR(false, options, "Not valid argument: %s.\n", argv[i]); }
+	}
+
+	GTR_ASSERT_OR(!options.Batch.empty(), options, "Project directory must be specified using -dir= or -projects=.\n");
+	//Checked before any project runs, so a typo doesn't stop a batch halfway
+	for (const auto& dir : options.Batch)
+		GTR_ASSERT_OR(std::filesystem::is_directory(dir), options, "Couldn't find directory: %s\n", dir.c_str());
+	if (options.Batch.size() == 1)//A single project runs as before
+	{
+		options.Dir = options.Batch.front();
+		options.Batch.clear();
+	}
+	return options;
+}
+
+//Value of an option that takes a non-negative integer, prefix is the length of "-option="
+[[nodiscard]] uint64_t number(const std::string& arg, size_t prefix, uint64_t max) noexcept
+{
+	const auto value = arg.substr(prefix);
+	const auto option = arg.substr(0, prefix - 1);
+	GTR_ASSERT_OR(!value.empty() && value.size() <= 19 && value.find_first_not_of("0123456789") == std::string::npos, 0, "%s should be a number but '%s' was given.\n", option.c_str(), value.c_str());
+	const uint64_t result = std::strtoull(value.c_str(), nullptr, 10);
+	GTR_ASSERT_OR(result <= max, 0, "%s should be at most %llu but '%s' was given.\n", option.c_str(), (unsigned long long)max, value.c_str());
+	return result;
+}
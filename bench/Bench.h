@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+namespace bench {
+
+	/**
+	* @brief What a benchmark gets on every run
+	* @details The body must do Iterations times the work it measures, each iteration handling Items things
+	*	(identifiers, strings, objects), so the time can be reported per item.
+	*/
+	struct State {
+		size_t Iterations = 1;
+		size_t Items = 1;
+	};
+
+	using Function = void(*)(State&);
+
+	struct Case {
+		const char* Name;
+		Function Run;
+	};
+
+	[[nodiscard]] std::vector<Case>& Registry(void) noexcept;
+
+	struct Register {
+		Register(const char* name, Function run) noexcept { Registry().push_back({ name, run }); }
+	};
+
+	/**
+	* @brief Keeps the compiler from dropping the computation of a value that is never used
+	*/
+	template<typename T>
+	inline void DoNotOptimize(const T& value) noexcept
+	{
+	#ifdef _MSC_VER
+		static const volatile void* sink;
+		sink = &value;
+		_ReadWriteBarrier();
+	#else
+		asm volatile("" : : "g"(&value) : "memory");
+	#endif
+	}
+
+	/**
+	* @brief Same seed on every run, so fixtures are the same on every machine
+	*/
+	class Random {
+	public:
+		Random(uint64_t seed = 0x9E3779B97F4A7C15ull) noexcept
+			: mState(seed) {}
+
+		//splitmix64
+		[[nodiscard]] uint64_t Next(void) noexcept
+		{
+			uint64_t z = (mState += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return z ^ (z >> 31);
+		}
+
+		[[nodiscard]] size_t Below(size_t count) noexcept { return (size_t)(Next() % count); }
+
+	private:
+		uint64_t mState;
+	};
+
+}
+
+#define BENCHMARK(name) \
+	static void name(bench::State& state); \
+	static const bench::Register s##name##Register(#name, name); \
+	static void name(bench::State& state)
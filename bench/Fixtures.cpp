@@ -0,0 +1,172 @@
+#include "Fixtures.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+
+//Every type a field can have, Unknown excluded
+static constexpr FieldType sTypes[] = {
+	FieldType::Bool, FieldType::Char, FieldType::Byte,
+	FieldType::Int16, FieldType::Int32, FieldType::Int64,
+	FieldType::Uint16, FieldType::Uint32, FieldType::Uint64,
+	FieldType::Float32, FieldType::Float64,
+	FieldType::Vec2, FieldType::Vec3, FieldType::Vec4,
+	FieldType::Enum_Char, FieldType::Enum_Byte, FieldType::Enum_Int16, FieldType::Enum_Int32,
+	FieldType::Enum_Int64, FieldType::Enum_Uint16, FieldType::Enum_Uint32, FieldType::Enum_Uint64,
+	FieldType::String, FieldType::Asset, FieldType::Entity
+};
+
+//Size & alignment on x64
+[[nodiscard]] static std::pair<size_t, size_t> layout(FieldType type) noexcept
+{
+	switch (type)
+	{
+	case FieldType::Bool:
+	case FieldType::Char:
+	case FieldType::Byte:
+	case FieldType::Enum_Char:
+	case FieldType::Enum_Byte:
+		return { 1, 1 };
+	case FieldType::Int16:
+	case FieldType::Uint16:
+	case FieldType::Enum_Int16:
+	case FieldType::Enum_Uint16:
+		return { 2, 2 };
+	case FieldType::Int32:
+	case FieldType::Uint32:
+	case FieldType::Float32:
+	case FieldType::Enum_Int32:
+	case FieldType::Enum_Uint32:
+	case FieldType::Entity:
+		return { 4, 4 };
+	case FieldType::Vec2: return { 8, 4 };
+	case FieldType::Vec3: return { 12, 4 };
+	case FieldType::Vec4: return { 16, 4 };
+	case FieldType::String: return { 32, 8 };
+	default:
+		return { 8, 8 };
+	}
+}
+
+[[nodiscard]] std::unordered_map<std::string, Enum> bench::MakeEnums(size_t count, size_t values) noexcept
+{
+	std::unordered_map<std::string, Enum> enums;
+	for (size_t i = 0; i < count; i++)
+	{
+		const auto name = "Enum" + std::to_string(i);
+		Enum enumeration(name, 4, i % 2 ? FieldType::Enum_Uint32 : FieldType::Enum_Int32);
+		for (size_t j = 0; j < values; j++)
+			enumeration.Values.insert({ name + "_Value" + std::to_string(j), EnumValue((int64_t)j) });
+		enums.insert({ name, enumeration });
+	}
+	return enums;
+}
+
+[[nodiscard]] Object bench::MakeObject(Random& random, const std::string& name, size_t fields, size_t enums) noexcept
+{
+	Object obj(name, 0, ReflectionType::Component);
+	obj.Header = "Game/Scripts/" + name + ".h";
+	obj.TypeId = (uint32_t)random.Below(1024);
+	obj.Storage.Instances = 4096;
+	obj.Storage.Chunk = 256;
+
+	size_t offset = 0, align = 1;
+	for (size_t i = 0; i < fields; i++)
+	{
+		const FieldType type = sTypes[(i + random.Below(3)) % std::size(sTypes)];
+		const auto [size, alignment] = layout(type);
+		offset = (offset + alignment - 1) / alignment * alignment;
+		align = std::max(align, alignment);
+
+		Field& field = obj.Fields.emplace_back("Field" + std::to_string(i), size, offset, type);
+		offset += size;
+		if (field.isEnum())
+			field.TypeName = "Enum" + std::to_string(random.Below(enums));
+
+		const auto value = (int64_t)random.Below(100);
+		switch (type)
+		{
+		case FieldType::Bool:
+			field.Default["Default"] = value % 2 == 0;
+			break;
+		case FieldType::Char:
+		case FieldType::Int16:
+		case FieldType::Int32:
+		case FieldType::Int64:
+		case FieldType::Enum_Char:
+		case FieldType::Enum_Int16:
+		case FieldType::Enum_Int32:
+		case FieldType::Enum_Int64:
+			field.Meta.MinInt = -100;
+			field.Meta.MaxInt = 100;
+			field.Default["Default"] = value;
+			break;
+		case FieldType::Byte:
+		case FieldType::Uint16:
+		case FieldType::Uint32:
+		case FieldType::Uint64:
+		case FieldType::Enum_Byte:
+		case FieldType::Enum_Uint16:
+		case FieldType::Enum_Uint32:
+		case FieldType::Enum_Uint64:
+			field.Meta.MinUint = 0;
+			field.Meta.MaxUint = 100;
+			field.Default["Default"] = (uint64_t)value;
+			break;
+		case FieldType::Float32:
+		case FieldType::Float64:
+			field.Meta.MinFloat = -1000.0;
+			field.Meta.MaxFloat = 1000.0;
+			field.Default["Default"] = value * 0.5;
+			break;
+		case FieldType::Vec2:
+			field.Default["Default"] = std::array<float, 2>{ value * 0.5f, 1.0f };
+			break;
+		case FieldType::Vec3:
+			field.Default["Default"] = std::array<float, 3>{ value * 0.5f, 1.0f, 0.0f };
+			break;
+		case FieldType::Vec4:
+			field.Default["Default"] = std::array<float, 4>{ 1.0f, 1.0f, 1.0f, value * 0.01f };
+			break;
+		case FieldType::String:
+			field.Meta.Length = 15;
+			field.Default["Default"] = "Name " + std::to_string(value);
+			break;
+		default:
+			break;
+		}
+	}
+	obj.Meta.Size = (offset + align - 1) / align * align;
+	return obj;
+}
+
+[[nodiscard]] std::vector<std::string> bench::MakeAnnotations(Random& random, size_t count) noexcept
+{
+	std::vector<std::string> annotations;
+	for (size_t i = 0; i < count; i++)
+	{
+		const auto n = std::to_string(random.Below(1000));
+		switch (random.Below(8))
+		{
+		case 0:
+			annotations.push_back("component: header=\"Game/Scripts/Player" + n + ".h\", name=\"Player " + n + "\", instances=4096, chunk=256, align=64, storage=dense, dirty=true");
+			break;
+		case 1:
+			annotations.push_back("system: header=\"Game/Systems/Movement" + n + ".h\"");
+			break;
+		case 2:
+			annotations.push_back("enum: name=\"Weapon " + n + "\"");
+			break;
+		case 3:
+			annotations.push_back("property: name=\"Title\", length=" + n);
+			break;
+		case 4:
+			annotations.push_back("property: name=\"Health\"");
+			break;
+		default:
+			annotations.push_back("property: name=\"Max Speed " + n + "\", min=-" + n + ", max=" + n + ".5, precision=0.01");
+			break;
+		}
+	}
+	return annotations;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Bench.h"
+#include "../src/reflect.h"
+
+#include <unordered_map>
+
+namespace bench {
+
+	/**
+	* @brief Enumerations named Enum0, Enum1... with values each, keyed by their name like Finder::Enums
+	*/
+	[[nodiscard]] std::unordered_map<std::string, Enum> MakeEnums(size_t count, size_t values) noexcept;
+
+	/**
+	* @brief Component with fields of every type, as PostbuildFinder would have found it
+	* @details Fields cycle through the types with bounds, defaults and offsets of a packed record, enum fields
+	*	refer to one of the enumerations made by MakeEnums(enums, ...).
+	*/
+	[[nodiscard]] Object MakeObject(Random& random, const std::string& name, size_t fields, size_t enums) noexcept;
+
+	/**
+	* @brief Annotations of records, fields and enumerations as they are found on the clangdump
+	*/
+	[[nodiscard]] std::vector<std::string> MakeAnnotations(Random& random, size_t count) noexcept;
+
+}
@@ -0,0 +1,92 @@
+#include "Fixtures.h"
+#include "../src/AnnotationParser.h"
+
+static constexpr size_t sCount = 1024;
+
+[[nodiscard]] static const std::vector<std::string>& annotations(void) noexcept
+{
+	static const std::vector<std::string> fixture = []()
+	{
+		bench::Random random;
+		return bench::MakeAnnotations(random, sCount);
+	}();
+	return fixture;
+}
+
+//Fields with bounds, parsed once
+[[nodiscard]] static const std::vector<AnnotationParser>& bounded(void) noexcept
+{
+	static const std::vector<AnnotationParser> fixture = []()
+	{
+		std::vector<AnnotationParser> parsers;
+		for (const auto& annotation : annotations())
+		{
+			AnnotationParser parser(annotation);
+			if (parser.Has("min"))
+				parsers.push_back(parser);
+		}
+		return parsers;
+	}();
+	return fixture;
+}
+
+BENCHMARK(annotation_Parse)
+{
+	const auto& strs = annotations();
+	state.Items = sCount;
+	AnnotationParser parser;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& str : strs)
+		{
+			parser.Parse(str);
+			bench::DoNotOptimize(parser);
+		}
+	}
+}
+
+BENCHMARK(annotation_Get)
+{
+	const auto& parsers = bounded();
+	state.Items = parsers.size() * 2;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& parser : parsers)
+		{
+			const auto name = parser.Get("name");
+			bench::DoNotOptimize(name);
+			const bool has = parser.Has("length");
+			bench::DoNotOptimize(has);
+		}
+	}
+}
+
+BENCHMARK(annotation_GetAs_int64)
+{
+	const auto& parsers = bounded();
+	state.Items = parsers.size();
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& parser : parsers)
+		{
+			const int64_t min = parser.GetAs<int64_t>("min");
+			bench::DoNotOptimize(min);
+		}
+	}
+}
+
+BENCHMARK(annotation_GetAs_double)
+{
+	const auto& parsers = bounded();
+	state.Items = parsers.size() * 2;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& parser : parsers)
+		{
+			const double max = parser.GetAs<double>("max");
+			bench::DoNotOptimize(max);
+			const double precision = parser.GetAs<double>("precision");
+			bench::DoNotOptimize(precision);
+		}
+	}
+}
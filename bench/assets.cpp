@@ -0,0 +1,98 @@
+#include "Fixtures.h"
+#include "../src/Assets.h"
+
+#include <sstream>
+
+static constexpr size_t sObjects = 16;
+static constexpr size_t sFields = 256;
+
+struct AssetFixture {
+	std::unordered_map<std::string, Enum> Enums;
+	std::vector<Object> Objects;
+	std::vector<std::string> Texts;//YAML bodies, without the size that precedes them
+	std::vector<YAML::Node> Nodes;
+	Migration Change;
+};
+
+//Large components, as written by PostbuildFinder::WriteObjects
+[[nodiscard]] static const AssetFixture& fixture(void) noexcept
+{
+	static const AssetFixture fixture = []()
+	{
+		bench::Random random;
+		AssetFixture assets;
+		assets.Enums = bench::MakeEnums(8, 16);
+		for (size_t i = 0; i < sObjects; i++)
+		{
+			auto& obj = assets.Objects.emplace_back(bench::MakeObject(random, "Component" + std::to_string(i), sFields, 8));
+			obj.Targets["aarch64-linux-android"] = { obj.Meta.Size, 8, std::vector<size_t>(sFields, 4), std::vector<size_t>(sFields, 4) };
+
+			std::ostringstream os;
+			WriteAsset(os, obj, assets.Enums, nullptr);
+			const auto text = os.str();
+			assets.Texts.push_back(text.substr(text.find("\n\n") + 2));
+			assets.Nodes.push_back(YAML::Load(assets.Texts.back()));
+		}
+		assets.Change = Diff(bench::MakeObject(random, "Component0", sFields, 8), assets.Objects[0]);
+		return assets;
+	}();
+	return fixture;
+}
+
+BENCHMARK(asset_Write)
+{
+	const auto& assets = fixture();
+	state.Items = sObjects;
+	std::ostringstream os;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& obj : assets.Objects)
+		{
+			os.str("");
+			WriteAsset(os, obj, assets.Enums, nullptr);
+			bench::DoNotOptimize(os);
+		}
+	}
+}
+
+BENCHMARK(asset_WriteMigration)
+{
+	const auto& assets = fixture();
+	state.Items = 1;
+	std::ostringstream os;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		os.str("");
+		WriteAsset(os, assets.Objects[0], assets.Enums, &assets.Change);
+		bench::DoNotOptimize(os);
+	}
+}
+
+BENCHMARK(asset_Read)
+{
+	const auto& assets = fixture();
+	state.Items = sObjects;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& node : assets.Nodes)
+		{
+			const Object obj = ReadAsset(node);
+			bench::DoNotOptimize(obj);
+		}
+	}
+}
+
+//Same as WriteObjects does for every asset: YAML is loaded and then read
+BENCHMARK(asset_LoadAndRead)
+{
+	const auto& assets = fixture();
+	state.Items = sObjects;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& text : assets.Texts)
+		{
+			const Object obj = ReadAsset(YAML::Load(text));
+			bench::DoNotOptimize(obj);
+		}
+	}
+}
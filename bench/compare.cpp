@@ -0,0 +1,109 @@
+#include "Fixtures.h"
+#include "../src/Layout.h"
+
+static constexpr size_t sObjects = 1024;
+static constexpr size_t sFields = 64;
+static constexpr size_t sEnums = 1024;
+static constexpr size_t sValues = 64;
+
+struct CompareFixture {
+	std::vector<Object> Objects;
+	std::vector<Object> Same;//Copies, so every field is compared
+	std::vector<Object> Changed;//Last field was renamed
+	std::vector<Enum> Enums;
+	std::vector<Enum> SameEnums;
+};
+
+//Objects & enumerations of a big project, as they are compared with the assets & the cache on postbuild
+[[nodiscard]] static const CompareFixture& fixture(void) noexcept
+{
+	static const CompareFixture fixture = []()
+	{
+		bench::Random random;
+		CompareFixture data;
+		for (size_t i = 0; i < sObjects; i++)
+		{
+			data.Objects.push_back(bench::MakeObject(random, "Component" + std::to_string(i), sFields, 8));
+			data.Same.push_back(data.Objects.back());
+			auto& changed = data.Changed.emplace_back(data.Objects.back());
+			changed.Fields.back().Meta.Name += "_";
+		}
+		for (auto& [name, enumeration] : bench::MakeEnums(sEnums, sValues))
+		{
+			data.Enums.push_back(enumeration);
+			data.SameEnums.push_back(enumeration);
+		}
+		return data;
+	}();
+	return fixture;
+}
+
+BENCHMARK(compare_Object_same)
+{
+	const auto& data = fixture();
+	state.Items = sObjects;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (size_t j = 0; j < sObjects; j++)
+		{
+			const bool equal = data.Objects[j] == data.Same[j];
+			bench::DoNotOptimize(equal);
+		}
+	}
+}
+
+BENCHMARK(compare_Object_changed)
+{
+	const auto& data = fixture();
+	state.Items = sObjects;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (size_t j = 0; j < sObjects; j++)
+		{
+			const bool equal = data.Objects[j] == data.Changed[j];
+			bench::DoNotOptimize(equal);
+		}
+	}
+}
+
+BENCHMARK(compare_Enum_same)
+{
+	const auto& data = fixture();
+	state.Items = sEnums;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (size_t j = 0; j < sEnums; j++)
+		{
+			const bool equal = data.Enums[j] == data.SameEnums[j];
+			bench::DoNotOptimize(equal);
+		}
+	}
+}
+
+BENCHMARK(layout_isTriviallyCopyable)
+{
+	const auto& data = fixture();
+	state.Items = sObjects;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& obj : data.Objects)
+		{
+			const bool trivial = isTriviallyCopyable(obj);
+			bench::DoNotOptimize(trivial);
+		}
+	}
+}
+
+BENCHMARK(layout_BakeDefaults)
+{
+	const auto& data = fixture();
+	state.Items = sObjects;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& obj : data.Objects)
+		{
+			const DefaultImage image = BakeDefaults(obj);
+			bench::DoNotOptimize(image);
+		}
+	}
+}
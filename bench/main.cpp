@@ -0,0 +1,64 @@
+//Microbenchmarks of the helpers of gtreflect that don't need clang
+//Usage: bench [-min=<ms per repetition>] [-repeat=<repetitions>] [filter]   Runs every benchmark whose name contains filter
+#include "Bench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+[[nodiscard]] std::vector<bench::Case>& bench::Registry(void) noexcept
+{
+	static std::vector<Case> cases;
+	return cases;
+}
+
+[[nodiscard]] static double run(bench::Function function, bench::State& state) noexcept
+{
+	const auto start = std::chrono::steady_clock::now();
+	function(state);
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, const char** argv)
+{
+	double minimum = 50.0;//ms
+	size_t repeat = 5;
+	const char* filter = "";
+	for (int i = 1; i < argc; i++)
+	{
+		if (strncmp(argv[i], "-min=", 5) == 0)
+			minimum = atof(argv[i] + 5);
+		else if (strncmp(argv[i], "-repeat=", 8) == 0)
+			repeat = std::max<size_t>(1, (size_t)atoll(argv[i] + 8));
+		else
+			filter = argv[i];
+	}
+
+	auto& cases = bench::Registry();
+	std::sort(cases.begin(), cases.end(), [](const bench::Case& lhs, const bench::Case& rhs) { return strcmp(lhs.Name, rhs.Name) < 0; });
+
+	printf("%-40s %12s %12s %12s %14s\n", "Benchmark", "Iterations", "ns/item min", "ns/item med", "items/s");
+	for (const auto& test : cases)
+	{
+		if (!strstr(test.Name, filter))
+			continue;
+
+		//Iterations are doubled until a single repetition takes long enough for the clock
+		bench::State state;
+		double elapsed = run(test.Run, state);
+		while (elapsed < minimum * 1e6 && state.Iterations < (size_t(1) << 40))
+		{
+			const double scale = elapsed > 0.0 ? std::min(minimum * 1e6 * 1.2 / elapsed, 10.0) : 10.0;
+			state.Iterations = std::max(state.Iterations * 2, (size_t)(state.Iterations * scale));
+			elapsed = run(test.Run, state);
+		}
+
+		std::vector<double> times;
+		for (size_t i = 0; i < repeat; i++)
+			times.push_back(run(test.Run, state) / (double)(state.Iterations * state.Items));
+		std::sort(times.begin(), times.end());
+		printf("%-40s %12zu %12.2f %12.2f %14.0f\n", test.Name, state.Iterations, times.front(), times[times.size() / 2], 1e9 / times.front());
+	}
+	return 0;
+}
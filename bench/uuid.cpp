@@ -0,0 +1,138 @@
+#include "Bench.h"
+#include "../src/uuid.h"
+
+#include <cctype>
+
+static constexpr size_t sCount = 1024;
+
+//Identifiers as they are found on assets, half of them in lower case
+[[nodiscard]] static const std::vector<std::string>& strings(void) noexcept
+{
+	static const std::vector<std::string> fixture = []()
+	{
+		bench::Random random;
+		std::vector<std::string> strs;
+		const uuid ns("6BA7B810-9DAD-11D1-80B4-00C04FD430C8");
+		for (size_t i = 0; i < sCount; i++)
+		{
+			auto str = uuid::FromName(ns, std::to_string(random.Next())).str();
+			if (i % 2)
+			{
+				for (auto& c : str)
+					c = (char)tolower(c);
+			}
+			strs.push_back(str);
+		}
+		return strs;
+	}();
+	return fixture;
+}
+
+BENCHMARK(uuid_Parse)
+{
+	const auto& strs = strings();
+	state.Items = sCount;
+	uuid id;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& str : strs)
+		{
+			(void)uuid::Parse(str, id);
+			bench::DoNotOptimize(id);
+		}
+	}
+}
+
+BENCHMARK(uuid_FromString)
+{
+	const auto& strs = strings();
+	state.Items = sCount;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& str : strs)
+		{
+			const uuid id(str);
+			bench::DoNotOptimize(id);
+		}
+	}
+}
+
+BENCHMARK(uuid_Format)
+{
+	std::vector<uuid> ids;
+	for (const auto& str : strings())
+		ids.emplace_back(str);
+	state.Items = sCount;
+	char out[36];
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& id : ids)
+		{
+			id.Format(out);
+			bench::DoNotOptimize(out);
+		}
+	}
+}
+
+BENCHMARK(uuid_str)
+{
+	std::vector<uuid> ids;
+	for (const auto& str : strings())
+		ids.emplace_back(str);
+	state.Items = sCount;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& id : ids)
+		{
+			const auto str = id.str();
+			bench::DoNotOptimize(str);
+		}
+	}
+}
+
+BENCHMARK(uuid_Create)
+{
+	state.Items = sCount;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (size_t j = 0; j < sCount; j++)
+		{
+			const uuid id = uuid::Create();
+			bench::DoNotOptimize(id);
+		}
+	}
+}
+
+BENCHMARK(uuid_FromName)
+{
+	const uuid ns("F4C47194-1638-4334-BEC0-7CC60FC8902E");
+	std::vector<std::string> names;
+	for (size_t i = 0; i < sCount; i++)
+		names.push_back("Game/Scripts/Component" + std::to_string(i) + ".gtcomp");
+	state.Items = sCount;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& name : names)
+		{
+			const uuid id = uuid::FromName(ns, name);
+			bench::DoNotOptimize(id);
+		}
+	}
+}
+
+BENCHMARK(uuid_Hash)
+{
+	std::vector<uuid> ids;
+	for (const auto& str : strings())
+		ids.emplace_back(str);
+	state.Items = sCount;
+	const std::hash<uuid> hasher;
+	for (size_t i = 0; i < state.Iterations; i++)
+	{
+		for (const auto& id : ids)
+		{
+			const size_t hash = hasher(id);
+			bench::DoNotOptimize(hash);
+		}
+	}
+}
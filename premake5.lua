@@ -1,154 +1,259 @@
---Put your llvm directory here
-llvmDir = "D:/dev/llvm-project"
-
-
-workspace "gtreflect"
-    architecture "x64"
-
-	configurations
-	{
-		"Debug",
-		"Release"
-	}
-
-	startproject "gtreflect"
-
-outputdir = "%{cfg.buildcfg}-%{cfg.system}"
-
-IncludeDirs = {}
-IncludeDirs["yaml"] = "3rdParty/yaml-cpp/include"
-IncludeDirs["clangtools"] = "%{llvmDir}/build/tools/clang/include"
-IncludeDirs["clangutils"] = "%{llvmDir}/utils/bazel/llvm-project-overlay/llvm/include"
-IncludeDirs["clangbuild"] = "%{llvmDir}/build/include"
-IncludeDirs["llvm"] = "%{llvmDir}/llvm/include"
-IncludeDirs["clang"] = "%{llvmDir}/clang/include"
-
-LibFiles = {}
-LibFiles["clangTooling"] = "clangTooling.lib"
-LibFiles["clangFrontend"] = "clangFrontend.lib"
-LibFiles["clangSerialization"] = "clangSerialization.lib"
-LibFiles["clangSupport"] = "clangSupport.lib"
-LibFiles["clangASTMatchers"] = "clangASTMatchers.lib"
-LibFiles["clangAST"] = "clangAST.lib"
-LibFiles["clangBasic"] = "clangBasic.lib"
-LibFiles["clangLex"] = "clangLex.lib"
-LibFiles["clangDriver"] = "clangDriver.lib"
-LibFiles["clangParse"] = "clangParse.lib"
-LibFiles["clangRewrite"] = "clangRewrite.lib"
-LibFiles["clangSema"] = "clangSema.lib"
-LibFiles["clangAnalysis"] = "clangAnalysis.lib"
-LibFiles["clangEdit"] = "clangEdit.lib"
-LibFiles["LLVMSupport"] = "LLVMSupport.lib"
-LibFiles["LLVMDebugInfoDWARF"] = "LLVMDebugInfoDWARF.lib"
-LibFiles["LLVMAsmParser"] = "LLVMAsmParser.lib"
-LibFiles["LLVMIRReader"] = "LLVMIRReader.lib"
-LibFiles["LLVMObject"] = "LLVMObject.lib"
-LibFiles["LLVMWindowsDriver"] = "LLVMWindowsDriver.lib"
-LibFiles["LLVMAnalysis"] = "LLVMAnalysis.lib"
-LibFiles["LLVMFrontendOpenMP"] = "LLVMFrontendOpenMP.lib"
-LibFiles["LLVMOption"] = "LLVMOption.lib"
-LibFiles["LLVMCore"] = "LLVMCore.lib"
-LibFiles["LLVMBitReader"] = "LLVMBitReader.lib"
-LibFiles["LLVMBitstreamReader"] = "LLVMBitstreamReader.lib"
-LibFiles["LLVMProfileData"] = "LLVMProfileData.lib"
-LibFiles["clangStaticAnalyzerCore"] = "clangStaticAnalyzerCore.lib"
-LibFiles["LLVMTargetParser"] = "LLVMTargetParser.lib"
-LibFiles["LLVMTextAPI"] = "LLVMTextAPI.lib"
-LibFiles["LLVMTransformUtils"] = "LLVMTransformUtils.lib"
-LibFiles["LLVMDemangle"] = "LLVMDemangle.lib"
-LibFiles["LLVMMC"] = "LLVMMC.lib"
-LibFiles["LLVMMCParser"] = "LLVMMCParser.lib"
-LibFiles["LLVMBinaryFormat"] = "LLVMBinaryFormat.lib"
-LibFiles["LLVMRemarks"] = "LLVMRemarks.lib"
-LibFiles["LLVMScalarOpts"] = "LLVMScalarOpts.lib"
-LibFiles["version"] = "version.lib"
-
-include "3rdParty/yaml-cpp"
-
-project "gtreflect"
-    location "src"
-    kind "ConsoleApp"
-    language "C++"
-	cppdialect "C++17"
-
-    targetdir("bin/" .. outputdir .. "/%{prj.name}")
-	objdir("bin-int/" .. outputdir .. "/%{prj.name}")
-
-    files
-    {
-        "src/**.cpp",
-        "src/**.hpp",
-        "src/**.h",
-    }
-
-    includedirs
-    {
-        "%{IncludeDirs.yaml}",
-        "%{IncludeDirs.clangtools}",
-        "%{IncludeDirs.clangutils}",
-        "%{IncludeDirs.clangbuild}",
-        "%{IncludeDirs.clang}",
-        "%{IncludeDirs.llvm}",
-    }
-
-    links
-    {
-        "yaml-cpp",
-        "%{LibFiles.clangAST}",
-        "%{LibFiles.clangASTMatchers}",
-        "%{LibFiles.clangBasic}",
-        "%{LibFiles.clangFrontend}",
-        "%{LibFiles.clangSerialization}",
-        "%{LibFiles.clangTooling}",
-        "%{LibFiles.clangSupport}",
-        "%{LibFiles.clangLex}",
-        "%{LibFiles.clangDriver}",
-        "%{LibFiles.clangParse}",
-        "%{LibFiles.clangRewrite}",
-        "%{LibFiles.clangSema}",
-        "%{LibFiles.clangAnalysis}",
-        "%{LibFiles.clangEdit}",
-        "%{LibFiles.LLVMSupport}",
-        "%{LibFiles.LLVMDebugInfoDWARF}",
-        "%{LibFiles.LLVMWindowsDriver}",
-        "%{LibFiles.LLVMAnalysis}",
-        "%{LibFiles.LLVMFrontendOpenMP}",
-        "%{LibFiles.LLVMAsmParser}",
-        "%{LibFiles.LLVMIRReader}",
-        "%{LibFiles.LLVMObject}",
-        "%{LibFiles.LLVMOption}",
-        "%{LibFiles.clangStaticAnalyzerCore}",
-        "%{LibFiles.LLVMTargetParser}",
-        "%{LibFiles.LLVMTextAPI}",
-        "%{LibFiles.LLVMTransformUtils}",
-        "%{LibFiles.LLVMCore}",
-        "%{LibFiles.LLVMBitReader}",
-        "%{LibFiles.LLVMBitstreamReader}",
-        "%{LibFiles.LLVMProfileData}",
-        "%{LibFiles.LLVMDemangle}",
-        "%{LibFiles.LLVMMC}",
-        "%{LibFiles.LLVMMCParser}",
-        "%{LibFiles.LLVMBinaryFormat}",
-        "%{LibFiles.LLVMRemarks}",
-        "%{LibFiles.LLVMScalarOpts}",
-        "%{LibFiles.version}",
-    }
-
-    defines { "_CRT_SECURE_NO_WARNINGS" }
-
-    filter "configurations:Debug"
-        runtime "Debug"
-        symbols "on"
-        libdirs
-        {
-            "%{llvmDir}/build/Debug/lib",
-        }
-
-    filter "configurations:Release"
-        runtime "Release"
-        optimize "on"
-
-        libdirs
-        {
-            "%{llvmDir}/build/Release/lib",
-        }
+--Put your llvm directory here
+llvmDir = "D:/dev/llvm-project"
+
+
+workspace "gtreflect"
+    architecture "x64"
+
+	configurations
+	{
+		"Debug",
+		"Release"
+	}
+
+	startproject "gtreflect"
+
+outputdir = "%{cfg.buildcfg}-%{cfg.system}"
+
+IncludeDirs = {}
+IncludeDirs["yaml"] = "3rdParty/yaml-cpp/include"
+IncludeDirs["clangtools"] = "%{llvmDir}/build/tools/clang/include"
+IncludeDirs["clangutils"] = "%{llvmDir}/utils/bazel/llvm-project-overlay/llvm/include"
+IncludeDirs["clangbuild"] = "%{llvmDir}/build/include"
+IncludeDirs["llvm"] = "%{llvmDir}/llvm/include"
+IncludeDirs["clang"] = "%{llvmDir}/clang/include"
+
+LibFiles = {}
+LibFiles["clangTooling"] = "clangTooling"
+LibFiles["clangFrontend"] = "clangFrontend"
+LibFiles["clangSerialization"] = "clangSerialization"
+LibFiles["clangSupport"] = "clangSupport"
+LibFiles["clangASTMatchers"] = "clangASTMatchers"
+LibFiles["clangAST"] = "clangAST"
+LibFiles["clangBasic"] = "clangBasic"
+LibFiles["clangLex"] = "clangLex"
+LibFiles["clangDriver"] = "clangDriver"
+LibFiles["clangParse"] = "clangParse"
+LibFiles["clangRewrite"] = "clangRewrite"
+LibFiles["clangSema"] = "clangSema"
+LibFiles["clangAnalysis"] = "clangAnalysis"
+LibFiles["clangEdit"] = "clangEdit"
+LibFiles["LLVMSupport"] = "LLVMSupport"
+LibFiles["LLVMDebugInfoDWARF"] = "LLVMDebugInfoDWARF"
+LibFiles["LLVMAsmParser"] = "LLVMAsmParser"
+LibFiles["LLVMIRReader"] = "LLVMIRReader"
+LibFiles["LLVMObject"] = "LLVMObject"
+LibFiles["LLVMWindowsDriver"] = "LLVMWindowsDriver"
+LibFiles["LLVMAnalysis"] = "LLVMAnalysis"
+LibFiles["LLVMFrontendOpenMP"] = "LLVMFrontendOpenMP"
+LibFiles["LLVMOption"] = "LLVMOption"
+LibFiles["LLVMCore"] = "LLVMCore"
+LibFiles["LLVMBitReader"] = "LLVMBitReader"
+LibFiles["LLVMBitstreamReader"] = "LLVMBitstreamReader"
+LibFiles["LLVMProfileData"] = "LLVMProfileData"
+LibFiles["clangStaticAnalyzerCore"] = "clangStaticAnalyzerCore"
+LibFiles["LLVMTargetParser"] = "LLVMTargetParser"
+LibFiles["LLVMTextAPI"] = "LLVMTextAPI"
+LibFiles["LLVMTransformUtils"] = "LLVMTransformUtils"
+LibFiles["LLVMDemangle"] = "LLVMDemangle"
+LibFiles["LLVMMC"] = "LLVMMC"
+LibFiles["LLVMMCParser"] = "LLVMMCParser"
+LibFiles["LLVMBinaryFormat"] = "LLVMBinaryFormat"
+LibFiles["LLVMRemarks"] = "LLVMRemarks"
+LibFiles["LLVMScalarOpts"] = "LLVMScalarOpts"
+
+include "3rdParty/yaml-cpp"
+
+--Core of reflection, can be linked by the editor or a build orchestrator to run it in-process
+project "libgtreflect"
+    location "src"
+    kind "StaticLib"
+    language "C++"
+	cppdialect "C++17"
+
+    targetdir("bin/" .. outputdir .. "/%{prj.name}")
+	objdir("bin-int/" .. outputdir .. "/%{prj.name}")
+
+    files
+    {
+        "src/**.cpp",
+        "src/**.hpp",
+        "src/**.h",
+    }
+
+    includedirs
+    {
+        "%{IncludeDirs.yaml}",
+        "%{IncludeDirs.clangtools}",
+        "%{IncludeDirs.clangutils}",
+        "%{IncludeDirs.clangbuild}",
+        "%{IncludeDirs.clang}",
+        "%{IncludeDirs.llvm}",
+    }
+
+    defines { "_CRT_SECURE_NO_WARNINGS" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
+
+project "gtreflect"
+    location "app"
+    kind "ConsoleApp"
+    language "C++"
+	cppdialect "C++17"
+
+    targetdir("bin/" .. outputdir .. "/%{prj.name}")
+	objdir("bin-int/" .. outputdir .. "/%{prj.name}")
+
+    files
+    {
+        "app/**.cpp",
+    }
+
+    includedirs
+    {
+        "src",
+        "%{IncludeDirs.yaml}",
+    }
+
+    links
+    {
+        "libgtreflect",
+        "yaml-cpp",
+        "%{LibFiles.clangAST}",
+        "%{LibFiles.clangASTMatchers}",
+        "%{LibFiles.clangBasic}",
+        "%{LibFiles.clangFrontend}",
+        "%{LibFiles.clangSerialization}",
+        "%{LibFiles.clangTooling}",
+        "%{LibFiles.clangSupport}",
+        "%{LibFiles.clangLex}",
+        "%{LibFiles.clangDriver}",
+        "%{LibFiles.clangParse}",
+        "%{LibFiles.clangRewrite}",
+        "%{LibFiles.clangSema}",
+        "%{LibFiles.clangAnalysis}",
+        "%{LibFiles.clangEdit}",
+        "%{LibFiles.LLVMSupport}",
+        "%{LibFiles.LLVMDebugInfoDWARF}",
+        "%{LibFiles.LLVMWindowsDriver}",
+        "%{LibFiles.LLVMAnalysis}",
+        "%{LibFiles.LLVMFrontendOpenMP}",
+        "%{LibFiles.LLVMAsmParser}",
+        "%{LibFiles.LLVMIRReader}",
+        "%{LibFiles.LLVMObject}",
+        "%{LibFiles.LLVMOption}",
+        "%{LibFiles.clangStaticAnalyzerCore}",
+        "%{LibFiles.LLVMTargetParser}",
+        "%{LibFiles.LLVMTextAPI}",
+        "%{LibFiles.LLVMTransformUtils}",
+        "%{LibFiles.LLVMCore}",
+        "%{LibFiles.LLVMBitReader}",
+        "%{LibFiles.LLVMBitstreamReader}",
+        "%{LibFiles.LLVMProfileData}",
+        "%{LibFiles.LLVMDemangle}",
+        "%{LibFiles.LLVMMC}",
+        "%{LibFiles.LLVMMCParser}",
+        "%{LibFiles.LLVMBinaryFormat}",
+        "%{LibFiles.LLVMRemarks}",
+        "%{LibFiles.LLVMScalarOpts}",
+    }
+
+    defines { "_CRT_SECURE_NO_WARNINGS" }
+
+    filter "system:windows"
+        links { "version" }
+
+    filter "system:linux"
+        links { "pthread", "dl", "z", "tinfo", "rt" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+        libdirs
+        {
+            "%{llvmDir}/build/Debug/lib",
+        }
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
+
+        libdirs
+        {
+            "%{llvmDir}/build/Release/lib",
+        }
+
+--Stand-in for the Engine's notification server, used to test the handshake without the Engine
+project "gtserver"
+    location "tools/gtserver"
+    kind "ConsoleApp"
+    language "C++"
+	cppdialect "C++17"
+
+    targetdir("bin/" .. outputdir .. "/%{prj.name}")
+	objdir("bin-int/" .. outputdir .. "/%{prj.name}")
+
+    files
+    {
+        "tools/gtserver/**.cpp",
+        "src/Transport.h",
+        "src/Transport.cpp",
+    }
+
+    filter "system:linux"
+        links { "pthread" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
+
+--Microbenchmarks of the parts that don't need clang, run the Release build: bench [filter]
+project "bench"
+    location "bench"
+    kind "ConsoleApp"
+    language "C++"
+	cppdialect "C++17"
+
+    targetdir("bin/" .. outputdir .. "/%{prj.name}")
+	objdir("bin-int/" .. outputdir .. "/%{prj.name}")
+
+    files
+    {
+        "bench/**.cpp",
+        "bench/**.h",
+        "src/AnnotationParser.cpp",
+        "src/Assets.cpp",
+        "src/Layout.cpp",
+        "src/Migration.cpp",
+        "src/uuid.cpp",
+    }
+
+    includedirs
+    {
+        "%{IncludeDirs.yaml}",
+    }
+
+    links
+    {
+        "yaml-cpp",
+    }
+
+    defines { "_CRT_SECURE_NO_WARNINGS" }
+
+    filter "configurations:Debug"
+        runtime "Debug"
+        symbols "on"
+
+    filter "configurations:Release"
+        runtime "Release"
+        optimize "on"
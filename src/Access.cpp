@@ -0,0 +1,270 @@
+#include "Access.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#pragma warning(push)
+#pragma warning(disable: 4146)
+#pragma warning(disable: 4244 4267 4291)
+#pragma warning(disable: 4624)
+#include <clang/AST/ASTContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#pragma warning(pop)
+
+enum class AccessKind {
+	Read,//Only checks for the component
+	Write,//Adds or removes the component
+	Usage,//Returns the component, depends on what is done with it
+	View//Iterates over the components, const ones are read
+};
+
+static const std::unordered_map<std::string, AccessKind> sFunctions = {
+	{ "HasComponent", AccessKind::Read },
+	{ "AddComponent", AccessKind::Write },
+	{ "AddOrReplaceComponent", AccessKind::Write },
+	{ "RemoveComponent", AccessKind::Write },
+	{ "GetComponent", AccessKind::Usage },
+	{ "TryGetComponent", AccessKind::Usage },
+	{ "GetAllEntitiesWith", AccessKind::View },
+	{ "View", AccessKind::View },
+	{ "view", AccessKind::View },
+	{ "group", AccessKind::View }
+};
+
+/**
+* @brief Checks whether a reference or a pointer of the given type allows modifying what it refers to
+*/
+[[nodiscard]] static bool is_mutable(const clang::QualType& type) noexcept
+{
+	if (type->isReferenceType() || type->isPointerType())
+		return !type->getPointeeType().isConstQualified();
+	return false;
+}
+
+/**
+* @brief Checks whether the component returned by the given expression may be modified
+* @details Walks up the parents until the value is either copied, bound to something const or modified.
+*	Anything that isn't understood counts as a modification.
+*/
+[[nodiscard]] static bool is_modified(clang::ASTContext& context, const clang::Expr* expr) noexcept
+{
+	using namespace clang;
+
+	const Stmt* current = expr;
+	while (true)
+	{
+		const auto parents = context.getParents(*current);
+		if (parents.empty())
+			return true;
+
+		if (const auto* var = parents[0].get<VarDecl>())
+			return is_mutable(var->getType());
+
+		const Stmt* parent = parents[0].get<Stmt>();
+		if (!parent)
+			return true;
+
+		if (isa<ParenExpr>(parent) || isa<MaterializeTemporaryExpr>(parent) || isa<ExprWithCleanups>(parent) ||
+			isa<ConditionalOperator>(parent) || isa<MemberExpr>(parent))
+		{
+			current = parent;
+			continue;
+		}
+		if (const auto* cast = dyn_cast<ImplicitCastExpr>(parent))
+		{
+			if (cast->getCastKind() == CK_LValueToRValue || cast->getType().isConstQualified())
+				return false;
+			current = parent;
+			continue;
+		}
+		if (const auto* subscript = dyn_cast<ArraySubscriptExpr>(parent))
+		{
+			if (subscript->getIdx() == current)
+				return false;
+			current = parent;
+			continue;
+		}
+		if (const auto* unary = dyn_cast<UnaryOperator>(parent))
+		{
+			if (unary->getOpcode() == UO_Deref)
+			{
+				current = parent;
+				continue;
+			}
+			return unary->isIncrementDecrementOp() || unary->getOpcode() == UO_AddrOf;
+		}
+		if (const auto* binary = dyn_cast<BinaryOperator>(parent))
+			return binary->isAssignmentOp() && binary->getLHS() == current;
+		if (const auto* call = dyn_cast<CXXMemberCallExpr>(parent))
+		{
+			if (call->getCallee() == current)
+				return !call->getMethodDecl() || !call->getMethodDecl()->isConst();
+		}
+		if (const auto* call = dyn_cast<CXXOperatorCallExpr>(parent))
+		{
+			//The object is the first argument of member operators
+			const auto* method = dyn_cast_or_null<CXXMethodDecl>(call->getCalleeDecl());
+			for (unsigned i = 0; method && i < call->getNumArgs(); i++)
+			{
+				if (call->getArg(i) != current)
+					continue;
+				if (i == 0)
+					return !method->isConst();
+				return i > method->getNumParams() || is_mutable(method->getParamDecl(i - 1)->getType());
+			}
+		}
+		if (const auto* call = dyn_cast<CallExpr>(parent))
+		{
+			const auto* callee = call->getDirectCallee();
+			for (unsigned i = 0; i < call->getNumArgs(); i++)
+			{
+				if (call->getArg(i) != current)
+					continue;
+				if (!callee || i >= callee->getNumParams())
+					return true;
+				return is_mutable(callee->getParamDecl(i)->getType());
+			}
+			return true;
+		}
+		if (const auto* construct = dyn_cast<CXXConstructExpr>(parent))
+		{
+			const auto* constructor = construct->getConstructor();
+			for (unsigned i = 0; i < construct->getNumArgs(); i++)
+			{
+				if (construct->getArg(i) == current)
+					return i >= constructor->getNumParams() || is_mutable(constructor->getParamDecl(i)->getType());
+			}
+			return true;
+		}
+		if (isa<InitListExpr>(parent))
+			return false;
+		return true;
+	}
+}
+
+class AccessVisitor : public clang::RecursiveASTVisitor<AccessVisitor> {
+public:
+	AccessVisitor(clang::ASTContext& context, AccessSet& access) noexcept
+		: mContext(context), mAccess(access) {}
+
+	/**
+	* @brief Visits the body of the function and of the functions of the project that it calls
+	*/
+	void Visit(const clang::FunctionDecl* function) noexcept
+	{
+		const clang::FunctionDecl* definition = nullptr;
+		if (!function->hasBody(definition))
+		{
+			//What it accesses can't be known, so the system must not run alongside any other
+			if (mUnresolved.insert(function->getCanonicalDecl()).second)
+				mAccess.Unresolved.push_back(function->getQualifiedNameAsString());
+			return;
+		}
+		if (!mVisited.insert(definition).second)
+			return;
+		TraverseStmt(definition->getBody());
+	}
+
+	bool VisitCallExpr(clang::CallExpr* call) noexcept
+	{
+		const auto* callee = call->getDirectCallee();
+		if (!callee)
+			return true;
+
+		const auto it = sFunctions.find(callee->getNameAsString());
+		if (it == sFunctions.end())
+		{
+			//Only functions of the project are followed, the Engine is trusted to do what its name says
+			const auto& sm = mContext.getSourceManager();
+			if (sm.isInMainFile(sm.getExpansionLoc(callee->getLocation())))
+				mPending.push_back(callee);
+			return true;
+		}
+
+		const auto* args = callee->getTemplateSpecializationArgs();
+		if (!args)
+			return true;
+		for (const auto& arg : args->asArray())
+		{
+			if (arg.getKind() == clang::TemplateArgument::Pack)
+			{
+				for (const auto& element : arg.pack_elements())
+					Found(element, it->second, call);
+			}
+			else
+				Found(arg, it->second, call);
+		}
+		return true;
+	}
+
+	/**
+	* @brief Visits the functions that were called until there are none left
+	*/
+	void Flush(void) noexcept
+	{
+		while (!mPending.empty())
+		{
+			const auto* function = mPending.back();
+			mPending.pop_back();
+			Visit(function);
+		}
+	}
+
+private:
+
+	void Found(const clang::TemplateArgument& arg, AccessKind kind, const clang::CallExpr* call) noexcept
+	{
+		if (arg.getKind() != clang::TemplateArgument::Type)
+			return;
+		const auto type = arg.getAsType();
+		const auto* record = type->getAsCXXRecordDecl();
+		if (!record)
+			return;
+
+		bool write = false;
+		switch (kind)
+		{
+		case AccessKind::Read:
+			break;
+		case AccessKind::Write:
+			write = true;
+			break;
+		case AccessKind::Usage:
+			write = !type.isConstQualified() && !call->getType().isConstQualified() && !(call->getType()->isPointerType() && call->getType()->getPointeeType().isConstQualified()) && is_modified(mContext, call);
+			break;
+		case AccessKind::View:
+			write = !type.isConstQualified();
+			break;
+		}
+
+		const auto name = record->getNameAsString();
+		if (write)
+		{
+			mAccess.Writes.insert(name);
+			mAccess.Reads.erase(name);
+		}
+		else if (mAccess.Writes.find(name) == mAccess.Writes.end())
+			mAccess.Reads.insert(name);
+	}
+
+private:
+	clang::ASTContext& mContext;
+	AccessSet& mAccess;
+	std::unordered_set<const clang::FunctionDecl*> mVisited;
+	std::unordered_set<const clang::FunctionDecl*> mUnresolved;
+	std::vector<const clang::FunctionDecl*> mPending;
+};
+
+[[nodiscard]] AccessSet AnalyzeAccess(const clang::CXXRecordDecl* record) noexcept
+{
+	AccessSet access;
+	AccessVisitor visitor(record->getASTContext(), access);
+	for (const auto* method : record->methods())
+	{
+		if (method->isImplicit() || method->isPure() || method->isDeleted() || method->isDefaulted())
+			continue;
+		visitor.Visit(method);
+		visitor.Flush();
+	}
+	return access;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "reflect.h"
+
+namespace clang { class CXXRecordDecl; }
+
+/**
+* @brief Finds the components that a system reads and writes
+* @details Walks the bodies of the member functions of the system, and of the functions of the project
+*	that they call, looking for GetComponent<T>, AddComponent<T>, HasComponent<T>, RemoveComponent<T>
+*	and views. Components taken as const, only checked for, or only copied are read; anything else
+*	that could modify them counts as a write. Member functions, and functions of the project that they
+*	call, defined outside of the headers can't be seen, so they are listed on AccessSet::Unresolved.
+*/
+[[nodiscard]] AccessSet AnalyzeAccess(const clang::CXXRecordDecl* record) noexcept;
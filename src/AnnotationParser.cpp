@@ -35,7 +35,7 @@ void AnnotationParser::Parse(const std::string& annotation) noexcept
 
 [[nodiscard]] std::string AnnotationParser::Get(const std::string& key) const noexcept
 {
-	GTR_ASSERT(Has(key), "Couldn't find the specified key: %s\n", key.c_str());
+	GTR_ASSERT_OR(Has(key), std::string(), "Couldn't find the specified key: %s\n", key.c_str());
 	return mValues.at(key);
 }
 
@@ -0,0 +1,86 @@
+#include "Artifacts.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+
+[[nodiscard]] std::ostream& Artifacts::Write(const std::filesystem::path& filepath, bool binary) noexcept
+{
+	const auto key = filepath.lexically_normal();
+	mRemoved.erase(std::remove(mRemoved.begin(), mRemoved.end(), key), mRemoved.end());
+
+	Entry& entry = mFiles[key];
+	entry.Stream.str("");
+	entry.Stream.clear();
+	entry.Binary = binary;
+	return entry.Stream;
+}
+
+[[nodiscard]] std::ostream& Artifacts::Append(const std::filesystem::path& filepath) noexcept
+{
+	const auto key = filepath.lexically_normal();
+	mRemoved.erase(std::remove(mRemoved.begin(), mRemoved.end(), key), mRemoved.end());
+	return mFiles[key].Stream;
+}
+
+void Artifacts::Remove(const std::filesystem::path& filepath) noexcept
+{
+	const auto key = filepath.lexically_normal();
+	mFiles.erase(key);
+	if (std::find(mRemoved.begin(), mRemoved.end(), key) == mRemoved.end())
+		mRemoved.push_back(key);
+}
+
+[[nodiscard]] bool Artifacts::Contains(const std::filesystem::path& filepath) const noexcept
+{
+	return mFiles.find(filepath.lexically_normal()) != mFiles.end();
+}
+
+[[nodiscard]] std::string Artifacts::Content(const std::filesystem::path& filepath) const noexcept
+{
+	const auto it = mFiles.find(filepath.lexically_normal());
+	return it != mFiles.end() ? it->second.Stream.str() : std::string();
+}
+
+[[nodiscard]] std::vector<std::filesystem::path> Artifacts::Files(void) const noexcept
+{
+	std::vector<std::filesystem::path> files;
+	for (const auto& [filepath, entry] : mFiles)
+		files.push_back(filepath);
+	return files;
+}
+
+void Artifacts::Flush(void) const noexcept
+{
+	for (const auto& filepath : mRemoved)
+		std::remove(filepath.string().c_str());
+
+	for (const auto& [filepath, entry] : mFiles)
+	{
+		auto temporary = filepath;
+		temporary += ".tmp";
+		std::ofstream os(temporary, entry.Binary ? std::ios::binary : std::ios::out);
+		os << entry.Stream.str();
+		os.close();
+
+		std::error_code error;
+		std::filesystem::rename(temporary, filepath, error);
+		if (error)
+		{
+			gtr::LogError("Couldn't write %s: %s\n", filepath.string().c_str(), error.message().c_str());
+			std::filesystem::remove(temporary, error);
+		}
+	}
+}
+
+[[nodiscard]] std::string Timestamp(void) noexcept
+{
+	//asctime and localtime share static buffers
+	static std::mutex mutex;
+	std::lock_guard lock(mutex);
+	std::time_t result = std::time(nullptr);
+	return std::asctime(std::localtime(&result));
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+* @brief Files generated by a single run of gtreflect
+* @details Everything is kept in memory while reflection runs, so in-process users can take the
+*	contents without touching the disk. Flush() writes them on disk at the end of the run.
+*/
+class Artifacts {
+public:
+
+	/**
+	* @brief Stream that replaces the contents of the given file
+	* @param binary Newlines are kept as they are instead of using the platform's ones
+	*/
+	[[nodiscard]] std::ostream& Write(const std::filesystem::path& filepath, bool binary = false) noexcept;
+
+	/**
+	* @brief Stream that appends to the given file, which starts empty if it wasn't written before
+	*/
+	[[nodiscard]] std::ostream& Append(const std::filesystem::path& filepath) noexcept;
+
+	/**
+	* @brief Marks a file for deletion, dropping anything written on it
+	*/
+	void Remove(const std::filesystem::path& filepath) noexcept;
+
+	[[nodiscard]] bool Contains(const std::filesystem::path& filepath) const noexcept;
+	[[nodiscard]] std::string Content(const std::filesystem::path& filepath) const noexcept;
+	[[nodiscard]] std::vector<std::filesystem::path> Files(void) const noexcept;
+	[[nodiscard]] const std::vector<std::filesystem::path>& Removed(void) const noexcept { return mRemoved; }
+
+	/**
+	* @brief Writes every file on disk and deletes the removed ones
+	* @details Files are written next to their destination and renamed over it, so readers never see half of a file
+	*/
+	void Flush(void) const noexcept;
+
+private:
+	struct Entry {
+		std::ostringstream Stream;
+		bool Binary = false;
+	};
+	std::map<std::filesystem::path, Entry> mFiles;
+	std::vector<std::filesystem::path> mRemoved;
+};
+
+/**
+* @brief Current local time as written on the comments of generated files, newline included
+* @details Same as asctime() but safe to call from runs on different threads
+*/
+[[nodiscard]] std::string Timestamp(void) noexcept;
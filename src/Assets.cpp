@@ -0,0 +1,235 @@
+#include "Assets.h"
+#include "Layout.h"
+
+static void input_metadata(const YAML::Node& data, FieldMetadata& meta, FieldType type) noexcept;
+static void output_metadata(YAML::Emitter& out, const FieldMetadata& data, const YAML::Node& Default);
+
+[[nodiscard]] Object ReadAsset(const YAML::Node& data) noexcept
+{
+	const auto name = data["Name"].as<std::string>();
+	ReflectionType type = (ReflectionType)data["Type"].as<uint64_t>();
+	Object obj(name, 1, type);
+	obj.Version = data["Version"].as<uint64_t>();
+	if (data["Header"])
+		obj.Header = data["Header"].as<std::string>();
+	if (data["TypeId"])
+		obj.TypeId = data["TypeId"].as<uint32_t>();
+	if (const auto storage = data["Storage"])
+	{
+		obj.Storage.Instances = storage["Instances"].as<uint64_t>();
+		obj.Storage.Chunk = storage["Chunk"].as<uint32_t>();
+		obj.Storage.Align = storage["Align"].as<uint32_t>();
+		obj.Storage.Kind = (StorageKind)storage["Kind"].as<uint64_t>();
+	}
+	for (const auto& target : data["Targets"])
+	{
+		auto& layout = obj.Targets[target.first.as<std::string>()];
+		layout.Size = target.second["Size"].as<size_t>();
+		layout.Align = target.second["Align"].as<size_t>();
+		layout.Offsets = target.second["Offsets"].as<std::vector<size_t>>();
+		layout.Sizes = target.second["Sizes"].as<std::vector<size_t>>();
+	}
+	YAML::Node fields = data["Fields"];
+	for (const auto& fielddata : fields)
+	{
+		const auto fname = fielddata["Name"].as<std::string>();
+		size_t size = fielddata["Size"].as<size_t>();
+		size_t offset = fielddata["Offset"].as<size_t>();
+		FieldType ftype = (FieldType)fielddata["Type"].as<uint64_t>();
+		Field& field = obj.Fields.emplace_back(fname, size, offset, ftype);
+		input_metadata(fielddata, field.Meta, ftype);
+		if (fielddata["Default"])
+			field.Default["Default"] = fielddata["Default"];
+	}
+	return obj;
+}
+
+void input_metadata(const YAML::Node& data, FieldMetadata& meta, FieldType type) noexcept
+{
+	switch (type)
+	{
+	case FieldType::Char:
+	case FieldType::Int16:
+	case FieldType::Int32:
+	case FieldType::Int64:
+	case FieldType::Enum_Char:
+	case FieldType::Enum_Int16:
+	case FieldType::Enum_Int32:
+	case FieldType::Enum_Int64:
+		meta.MinInt = data["min"].as<int64_t>();
+		meta.MaxInt = data["max"].as<int64_t>();
+		break;
+	case FieldType::Byte:
+	case FieldType::Uint16:
+	case FieldType::Uint32:
+	case FieldType::Uint64:
+	case FieldType::Enum_Byte:
+	case FieldType::Enum_Uint16:
+	case FieldType::Enum_Uint32:
+	case FieldType::Enum_Uint64:
+		meta.MinUint = data["min"].as<uint64_t>();
+		meta.MaxUint = data["max"].as<uint64_t>();
+		break;
+	case FieldType::Float32:
+	case FieldType::Float64:
+	case FieldType::Vec2:
+	case FieldType::Vec3:
+	case FieldType::Vec4:
+		meta.MinFloat = data["min"].as<double>();
+		meta.MaxFloat = data["max"].as<double>();
+		break;
+	case FieldType::String:
+		meta.Length = data["length"].as<size_t>();
+		break;
+	default:
+		break;
+	}
+}
+
+void WriteAsset(std::ostream& os, const Object& obj, const std::unordered_map<std::string, Enum>& enums, const Migration* migration) noexcept
+{
+	YAML::Emitter out;
+	out << YAML::BeginMap;
+	out << YAML::Key << "Name" << YAML::Value << obj.Meta.Name;
+	out << YAML::Key << "Header" << YAML::Value << obj.Header;
+	out << YAML::Key << "Version" << YAML::Value << obj.Version;
+	out << YAML::Key << "Type" << YAML::Value << (uint64_t)obj.Meta.Type;
+	if (obj.TypeId != Object::InvalidTypeId)
+		out << YAML::Key << "TypeId" << YAML::Value << obj.TypeId;
+	out << YAML::Key << "Size" << YAML::Value << obj.Meta.Size;
+	if (obj.Meta.Type == ReflectionType::Component)
+	{
+		out << YAML::Key << "Storage" << YAML::Value << YAML::Flow << YAML::BeginMap <<
+			YAML::Key << "Instances" << YAML::Value << obj.Storage.Instances <<
+			YAML::Key << "Chunk" << YAML::Value << obj.Storage.Chunk <<
+			YAML::Key << "Align" << YAML::Value << obj.Storage.Align <<
+			YAML::Key << "Kind" << YAML::Value << (uint64_t)obj.Storage.Kind <<
+			YAML::EndMap;
+	}
+	if (!obj.Targets.empty())
+	{
+		out << YAML::Key << "Targets" << YAML::Value << YAML::BeginMap;
+		for (const auto& [triple, layout] : obj.Targets)
+		{
+			out << YAML::Key << triple << YAML::Value << YAML::Flow << YAML::BeginMap <<
+				YAML::Key << "Size" << YAML::Value << layout.Size <<
+				YAML::Key << "Align" << YAML::Value << layout.Align <<
+				YAML::Key << "Offsets" << YAML::Value << YAML::Flow << layout.Offsets <<
+				YAML::Key << "Sizes" << YAML::Value << YAML::Flow << layout.Sizes <<
+				YAML::EndMap;
+		}
+		out << YAML::EndMap;
+	}
+	out << YAML::Key << "Fields" << YAML::Value << YAML::BeginSeq;
+	for (const auto& field : obj.Fields)
+	{
+		out << YAML::BeginMap;
+		out << YAML::Key << "Name" << YAML::Value << field.Meta.Name;
+		out << YAML::Key << "Type" << YAML::Value << (uint64_t)field.Meta.ValueType;
+		if (field.isEnum())
+		{
+			std::string Typename = enums.at(field.TypeName).Meta.Name;
+			out << YAML::Key << "TypeName" << YAML::Value << Typename;
+		}
+		out << YAML::Key << "Offset" << YAML::Value << field.Offset;
+		out << YAML::Key << "Size" << YAML::Value << field.Meta.Size;
+		output_metadata(out, field.Meta, field.Default);
+		out << YAML::EndMap;
+	}
+	out << YAML::EndSeq;
+
+	//Prebaked image so instances can be created by copying
+	const DefaultImage image = BakeDefaults(obj);
+	out << YAML::Key << "Defaults" << YAML::Value << YAML::BeginMap;
+	out << YAML::Key << "Ranges" << YAML::Value << YAML::Flow << YAML::BeginSeq;
+	for (const auto& range : image.Ranges)
+		out << YAML::Flow << YAML::BeginSeq << range.Offset << range.Size << YAML::EndSeq;
+	out << YAML::EndSeq;
+	out << YAML::Key << "Image" << YAML::Value << YAML::Binary(image.Bytes.data(), image.Bytes.size());
+	out << YAML::Key << "Fixups" << YAML::Value << YAML::Flow << image.Fixups;
+	out << YAML::EndMap;
+
+	//Offsets of Entity & Asset fields, so they can be visited without looking at the rest
+	const ReferenceOffsets references = GatherReferences(obj);
+	out << YAML::Key << "References" << YAML::Value << YAML::Flow << YAML::BeginMap;
+	out << YAML::Key << "Entities" << YAML::Value << YAML::Flow << references.Entities;
+	out << YAML::Key << "Assets" << YAML::Value << YAML::Flow << references.Assets;
+	out << YAML::EndMap;
+
+	//How to migrate instances of the previous version in place
+	if (migration)
+	{
+		auto write_pairs = [&out](const char* key, const std::vector<std::pair<size_t, size_t>>& pairs)
+		{
+			out << YAML::Key << key << YAML::Value << YAML::Flow << YAML::BeginSeq;
+			for (const auto& [from, to] : pairs)
+				out << YAML::Flow << YAML::BeginSeq << from << to << YAML::EndSeq;
+			out << YAML::EndSeq;
+		};
+		out << YAML::Key << "Migration" << YAML::Value << YAML::BeginMap;
+		out << YAML::Key << "From" << YAML::Value << migration->From;
+		write_pairs("Matched", migration->Matched);
+		write_pairs("Changed", migration->Changed);
+		out << YAML::Key << "Added" << YAML::Value << YAML::Flow << migration->Added;
+		out << YAML::Key << "Removed" << YAML::Value << YAML::Flow << migration->Removed;
+		out << YAML::Key << "Program" << YAML::Value << YAML::BeginSeq;
+		for (const auto& instruction : migration->Program)
+			out << YAML::Flow << YAML::BeginSeq << instruction[0] << instruction[1] << instruction[2] << instruction[3] << YAML::EndSeq;
+		out << YAML::EndSeq;
+		out << YAML::EndMap;
+	}
+	out << YAML::EndMap;
+
+	std::string buff(out.c_str());
+	os << buff.size() << '\n' << '\n';
+	os << buff;
+}
+
+void output_metadata(YAML::Emitter& out, const FieldMetadata& data, const YAML::Node& Default)
+{
+	switch (data.ValueType)
+	{
+	case FieldType::Char:
+	case FieldType::Int16:
+	case FieldType::Int32:
+	case FieldType::Int64:
+	case FieldType::Enum_Char:
+	case FieldType::Enum_Int16:
+	case FieldType::Enum_Int32:
+	case FieldType::Enum_Int64:
+		out << YAML::Key << "min" << YAML::Value << data.MinInt;
+		out << YAML::Key << "max" << YAML::Value << data.MaxInt;
+		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
+		break;
+	case FieldType::Byte:
+	case FieldType::Uint16:
+	case FieldType::Uint32:
+	case FieldType::Uint64:
+	case FieldType::Enum_Byte:
+	case FieldType::Enum_Uint16:
+	case FieldType::Enum_Uint32:
+	case FieldType::Enum_Uint64:
+		out << YAML::Key << "min" << YAML::Value << data.MinUint;
+		out << YAML::Key << "max" << YAML::Value << data.MaxUint;
+		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
+		break;
+	case FieldType::Float32:
+	case FieldType::Float64:
+	case FieldType::Vec2:
+	case FieldType::Vec3:
+	case FieldType::Vec4:
+		out << YAML::Key << "min" << YAML::Value << data.MinFloat;
+		out << YAML::Key << "max" << YAML::Value << data.MaxFloat;
+		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
+		break;
+	case FieldType::String:
+		out << YAML::Key << "length" << YAML::Value << data.Length;
+		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
+		break;
+	case FieldType::Bool:
+		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
+		break;
+	default:
+		break;
+	}
+}
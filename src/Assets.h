@@ -0,0 +1,20 @@
+#pragma once
+
+#include "reflect.h"
+#include "Migration.h"
+
+#include <ostream>
+#include <unordered_map>
+
+/**
+* @brief Reads an object from the YAML body of its Native-Script asset (.gtscript, .gtcomp or .gtsystem)
+* @details Only what is compared with the parsed objects is read, Defaults & References are rebuilt on every write
+*/
+[[nodiscard]] Object ReadAsset(const YAML::Node& data) noexcept;
+
+/**
+* @brief Writes the YAML body of the Native-Script asset of an object, preceded by its size and an empty line
+* @param enums Every reflected enumeration, enum fields are written with the name of their type
+* @param migration How instances of the previous version are migrated, nullptr for new objects
+*/
+void WriteAsset(std::ostream& os, const Object& obj, const std::unordered_map<std::string, Enum>& enums, const Migration* migration) noexcept;
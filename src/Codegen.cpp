@@ -0,0 +1,1204 @@
+#include "Codegen.h"
+#include "Finders.h"
+#include "Layout.h"
+#include "PerfectHash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <set>
+#include <sstream>
+
+[[nodiscard]] std::string exportname(const Object& obj) noexcept
+{
+	auto metaname = obj.Meta.Name;
+	size_t index = metaname.find(' ');
+	while (index != std::string::npos)
+	{
+		metaname.replace(index, 1, "_");
+		index = metaname.find(' ', index + 1);
+	}
+	return !metaname.empty() ? metaname : obj.Name;
+}
+
+[[nodiscard]] std::string includepath(const std::string& header) noexcept
+{
+	auto include = header;
+	const size_t index = include.find("src");
+	if (index != std::string::npos)
+		include = include.substr(index + 4);
+	std::replace(include.begin(), include.end(), '\\', '/');
+	return include;
+}
+
+[[nodiscard]] std::vector<const Object*> gather(const std::unordered_map<std::string, Object>& objects, ReflectionType type) noexcept
+{
+	std::vector<const Object*> result;
+	for (const auto& [name, obj] : objects)
+	{
+		if (obj.Meta.Name.empty())
+			continue;
+		const ReflectionType objtype = obj.Meta.Type == ReflectionType::Component || obj.Meta.Type == ReflectionType::System ? obj.Meta.Type : ReflectionType::Object;
+		if (objtype == type)
+			result.push_back(&obj);
+	}
+	std::sort(result.begin(), result.end(), [](const Object* lhs, const Object* rhs)
+	{
+		if (lhs->TypeId != rhs->TypeId) return lhs->TypeId < rhs->TypeId;
+		return lhs->Name < rhs->Name;
+	});
+	return result;
+}
+
+[[nodiscard]] const char* linkage(const Options& options) noexcept
+{
+	return options.Registry ? "static " : "extern \"C\" GAME_API ";
+}
+
+void PrebuildFinder::WriteTypeIds(uint32_t count) noexcept
+{
+	const auto components = gather(Objects, ReflectionType::Component);
+	auto& os = Files.Append(mProjectDir / "Exports.h");
+	os << "\nnamespace gtr {\n\n" <<
+		"\t//Dense ids of components, same as the ones on the Native-Script Assets\n" <<
+		"\tconstexpr uint32_t ComponentCount = " << count << ";\n\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tstruct TypeId;\n\n";
+	for (const Object* obj : components)
+		os << "\ttemplate<> struct TypeId<" << obj->Name << "> { static constexpr uint32_t Value = " << obj->TypeId << "; };\n";
+	os << "\n}\n";
+}
+
+void PrebuildFinder::WriteRegistry(uint32_t count) noexcept
+{
+	const auto components = gather(Objects, ReflectionType::Component);
+	const auto scripts = gather(Objects, ReflectionType::Object);
+	const auto systems = gather(Objects, ReflectionType::System);
+
+	//Components are indexed by their id, so ids that aren't in use leave holes on the table
+	std::vector<const Object*> slots(count, nullptr);
+	for (const Object* obj : components)
+		slots[obj->TypeId] = obj;
+
+	//Types that both the engine and the game agree upon
+	std::ostream os(Files.Append(mProjectDir / "Exports.h").rdbuf());
+	os << '\n';
+	PerfectHash::WriteSource(os);
+	os << "namespace gtr {\n\n" <<
+		"\tconstexpr uint32_t RegistryVersion = 7;\n\n" <<
+		"\tstruct NameIndex { uint32_t Size; const uint32_t* Seeds; const uint32_t* Slots; };\n\n" <<
+		"\tenum class StorageKind : uint8_t { Dense, Sparse };\n\n" <<
+		"\t//Zero means that there is no hint, Align is never below the natural alignment\n" <<
+		"\tstruct StorageHints { uint64_t Instances; uint32_t Chunk; uint32_t Align; StorageKind Kind; };\n\n" <<
+		"\tstruct ComponentEntry {\n" <<
+		"\t\tconst char* Name;\n" <<
+		"\t\tvoid* (*Create)(Entity);\n" <<
+		"\t\tvoid* (*Get)(Entity);\n" <<
+		"\t\tbool (*Has)(Entity);\n" <<
+		"\t\tvoid (*Remove)(Entity);\n" <<
+		"\t\tSaveFn Save;\n" <<
+		"\t\tLoadFn Load;\n" <<
+		"\t\tSaveQuantizedFn SaveQuantized;\n" <<
+		"\t\tLoadQuantizedFn LoadQuantized;\n" <<
+		"\t\tStorageHints Storage;\n" <<
+		"\t\tconst DirtyLayout* Dirty;//nullptr for components without dirty=true\n" <<
+		"\t\tconst SoALayout* SoA;//nullptr for components without soa=true\n" <<
+		"\t\tconst ReferenceLayout* References;\n" <<
+		"\t};\n\n" <<
+		"\tstruct ScriptEntry { const char* Name; ScriptableEntity* (*Create)(void); const ReferenceLayout* References; };\n" <<
+		"\tstruct SystemEntry { const char* Name; System* (*Create)(void); const ReferenceLayout* References; };\n\n" <<
+		"\tstruct Registry {\n" <<
+		"\t\tuint32_t Version;\n" <<
+		"\t\tuint32_t ComponentCount;\n" <<
+		"\t\tconst ComponentEntry* Components;//Indexed by component id, Name is nullptr for ids not in use\n" <<
+		"\t\tNameIndex ComponentNames;\n" <<
+		"\t\tuint32_t ScriptCount;\n" <<
+		"\t\tconst ScriptEntry* Scripts;\n" <<
+		"\t\tNameIndex ScriptNames;\n" <<
+		"\t\tuint32_t SystemCount;\n" <<
+		"\t\tconst SystemEntry* Systems;\n" <<
+		"\t\tNameIndex SystemNames;\n" <<
+		"\t\tconst SystemSchedule* Schedule;//Same order as Systems\n" <<
+		"\t};\n\n" <<
+		"\ttemplate<typename Entry>\n" <<
+		"\t[[nodiscard]] inline const Entry* Find(const Entry* entries, uint32_t count, const NameIndex& index, std::string_view name) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tconst uint32_t i = Lookup(index.Seeds, index.Slots, index.Size, name);\n" <<
+		"\t\tif (i >= count || entries[i].Name == nullptr || name.compare(entries[i].Name) != 0) return nullptr;\n" <<
+		"\t\treturn &entries[i];\n" <<
+		"\t}\n\n" <<
+		"}\n";
+
+	//Factories are only reachable through the table
+	os.rdbuf(Files.Append(mProjectDir / "Exports.cpp").rdbuf());
+	os << "\n\nnamespace {\n\n";
+	for (const Object* obj : components)
+	{
+		const auto writename = exportname(*obj);
+		os << "\tvoid* Create" << writename << "(Entity entity) { return &entity.AddComponent<" << obj->Name << ">(); }\n";
+		os << "\tvoid* Get" << writename << "(Entity entity) { return &entity.GetComponent<" << obj->Name << ">(); }\n";
+		os << "\tbool Has" << writename << "(Entity entity) { return entity.HasComponent<" << obj->Name << ">(); }\n";
+		os << "\tvoid Remove" << writename << "(Entity entity) { entity.RemoveComponent<" << obj->Name << ">(); }\n\n";
+	}
+	for (const Object* obj : scripts)
+		os << "\tScriptableEntity* Create" << exportname(*obj) << "(void) { return new " << obj->Name << "(); }\n";
+	for (const Object* obj : systems)
+		os << "\tSystem* Create" << exportname(*obj) << "(void) { return new " << obj->Name << "(); }\n";
+	os << '\n';
+
+	auto write_table = [&os](const char* type, const std::string& table, const std::vector<const Object*>& objects, bool isComponent)
+	{
+		//Slots of the name index point to the position on the table
+		std::vector<std::string> names;
+		std::vector<uint32_t> indices;
+		for (uint32_t i = 0; i < (uint32_t)objects.size(); i++)
+		{
+			if (!objects[i])
+				continue;
+			names.push_back(objects[i]->Meta.Name);
+			indices.push_back(i);
+		}
+		PerfectHash index = PerfectHash::Build(names);
+		for (auto& slot : index.Slots)
+			slot = indices[slot];
+		index.WriteTables(os, table);
+
+		if (objects.empty())
+			return;
+		os << "\tconstexpr gtr::" << type << ' ' << table << "[] = {\n";
+		for (const Object* obj : objects)
+		{
+			if (!obj)
+			{
+				os << "\t\t{ nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, {}, nullptr, nullptr, nullptr },\n";
+				continue;
+			}
+			const auto writename = exportname(*obj);
+			os << "\t\t{ \"" << obj->Meta.Name << "\", Create" << writename;
+			if (isComponent)
+			{
+				const auto& storage = obj->Storage;
+				os << ", Get" << writename << ", Has" << writename << ", Remove" << writename << ", Save" << writename << ", Load" << writename <<
+					", SaveQuantized" << writename << ", LoadQuantized" << writename <<
+					", { " << storage.Instances << "u, " << storage.Chunk << "u, " << storage.Align << "u, gtr::StorageKind::" << (storage.Kind == StorageKind::Sparse ? "Sparse" : "Dense") << " }, " <<
+					(obj->TrackChanges ? "&gtr::Tracked<" + obj->Name + ">::Layout" : std::string("nullptr")) << ", " <<
+					(obj->Columnar ? "&gtr::SoA<" + obj->Name + ">::Layout" : std::string("nullptr"));
+			}
+			os << ", &gtr::References<" << obj->Name << ">::Layout },\n";
+		}
+		os << "\t};\n\n";
+	};
+	write_table("ComponentEntry", "sComponents", slots, true);
+	write_table("ScriptEntry", "sScripts", scripts, false);
+	write_table("SystemEntry", "sSystems", systems, false);
+
+	auto write_entry = [&os](const std::string& table, size_t count, size_t names)
+	{
+		os << "\t\t" << count << ", " << (count ? table : "nullptr") << ", { " << names << ", " << table << "Seeds, " << table << "Slots },\n";
+	};
+	os << "\tconstexpr gtr::Registry sRegistry = {\n" <<
+		"\t\tgtr::RegistryVersion,\n";
+	write_entry("sComponents", slots.size(), components.size());
+	write_entry("sScripts", scripts.size(), scripts.size());
+	write_entry("sSystems", systems.size(), systems.size());
+	os << "\t\t&sSchedule\n" <<
+		"\t};\n\n" <<
+		"}\n\n" <<
+		"extern \"C\" GAME_API const gtr::Registry* GetReflectionRegistry(void) { return &sRegistry; }\n";
+}
+
+void PrebuildFinder::WriteSchedule(void) noexcept
+{
+	const auto systems = gather(Objects, ReflectionType::System);
+
+	std::ostream os(Files.Append(mProjectDir / "Exports.h").rdbuf());
+	os << "\nnamespace gtr {\n\n" <<
+		"\t//Components are given by their ids, systems that aren't Complete may touch any component\n" <<
+		"\tstruct SystemAccess {\n" <<
+		"\t\tconst char* Name;\n" <<
+		"\t\tuint32_t ReadCount;\n" <<
+		"\t\tconst uint32_t* Reads;\n" <<
+		"\t\tuint32_t WriteCount;\n" <<
+		"\t\tconst uint32_t* Writes;\n" <<
+		"\t\tbool Complete;\n" <<
+		"\t\tuint32_t ConflictCount;\n" <<
+		"\t\tconst uint32_t* Conflicts;//Indices of the systems that can't run at the same time\n" <<
+		"\t};\n\n" <<
+		"\tstruct SystemSchedule { uint32_t Count; const SystemAccess* Systems; };\n\n" <<
+		"}\n";
+
+	//Only reflected components have ids, but conflicts are found using every type that was accessed
+	auto write_ids = [this, &os](const std::string& table, const std::set<std::string>& names)
+	{
+		std::vector<uint32_t> ids;
+		for (const auto& name : names)
+		{
+			const auto it = Objects.find(name);
+			if (it != Objects.end() && it->second.TypeId != Object::InvalidTypeId)
+				ids.push_back(it->second.TypeId);
+		}
+		std::sort(ids.begin(), ids.end());
+		if (ids.empty())
+			return ids.size();
+		os << "\tconstexpr uint32_t " << table << "[] = { ";
+		for (size_t i = 0; i < ids.size(); i++)
+			os << (i == 0 ? "" : ", ") << ids[i];
+		os << " };\n";
+		return ids.size();
+	};
+
+	os.rdbuf(Files.Append(mProjectDir / "Exports.cpp").rdbuf());
+	os << "\n\nnamespace {\n\n";
+	std::vector<size_t> reads, writes, conflicts;
+	for (size_t i = 0; i < systems.size(); i++)
+	{
+		const Object* obj = systems[i];
+		const auto writename = exportname(*obj);
+		if (!obj->Access.isComplete())
+		{
+			gtr::Log("System %s will not run alongside other systems, these functions it calls are defined outside of the headers:", obj->Name.c_str());
+			for (const auto& name : obj->Access.Unresolved)
+				gtr::Log(" %s", name.c_str());
+			gtr::Log("\n");
+		}
+
+		reads.push_back(write_ids("s" + writename + "Reads", obj->Access.Reads));
+		writes.push_back(write_ids("s" + writename + "Writes", obj->Access.Writes));
+
+		std::vector<size_t> others;
+		for (size_t j = 0; j < systems.size(); j++)
+		{
+			if (j != i && obj->Access.Conflicts(systems[j]->Access))
+				others.push_back(j);
+		}
+		conflicts.push_back(others.size());
+		if (others.empty())
+			continue;
+		os << "\tconstexpr uint32_t s" << writename << "Conflicts[] = { ";
+		for (size_t j = 0; j < others.size(); j++)
+			os << (j == 0 ? "" : ", ") << others[j];
+		os << " };\n";
+	}
+
+	auto write_table = [&os](const std::string& table, size_t count)
+	{
+		os << ", " << count << ", " << (count ? table : "nullptr");
+	};
+	if (!systems.empty())
+	{
+		os << "\n\tconstexpr gtr::SystemAccess sSystemAccess[] = {\n";
+		for (size_t i = 0; i < systems.size(); i++)
+		{
+			const auto writename = exportname(*systems[i]);
+			os << "\t\t{ \"" << systems[i]->Meta.Name << '"';
+			write_table("s" + writename + "Reads", reads[i]);
+			write_table("s" + writename + "Writes", writes[i]);
+			os << ", " << (systems[i]->Access.isComplete() ? "true" : "false");
+			write_table("s" + writename + "Conflicts", conflicts[i]);
+			os << " },\n";
+		}
+		os << "\t};\n";
+	}
+	os << "\n\tconstexpr gtr::SystemSchedule sSchedule = { " << systems.size() << ", " << (systems.empty() ? "nullptr" : "sSystemAccess") << " };\n\n" <<
+		"}\n";
+	if (!mOptions.Registry)
+		os << "\nextern \"C\" GAME_API const gtr::SystemSchedule* GetSystemSchedule(void) { return &sSchedule; }\n";
+}
+
+void PrebuildFinder::WriteSerializers(void) noexcept
+{
+	const auto components = gather(Objects, ReflectionType::Component);
+
+	std::ostream os(Files.Append(mProjectDir / "Exports.h").rdbuf());
+	os << "\n#include <cstdint>\n" <<
+		"#include <cstring>\n" <<
+		"#include <string>\n" <<
+		"#include <vector>\n\n" <<
+		"namespace gtr {\n\n" <<
+		"\t//Entity & Asset fields are written by the Engine, every hook must be set\n" <<
+		"\tstruct SerializationHooks {\n" <<
+		"\t\tvoid* User = nullptr;\n" <<
+		"\t\tvoid (*SaveEntity)(void* user, const void* entity, std::vector<uint8_t>& out) = nullptr;\n" <<
+		"\t\tvoid (*LoadEntity)(void* user, void* entity, const uint8_t*& in) = nullptr;\n" <<
+		"\t\tvoid (*SaveAsset)(void* user, const void* asset, std::vector<uint8_t>& out) = nullptr;\n" <<
+		"\t\tvoid (*LoadAsset)(void* user, void* asset, const uint8_t*& in) = nullptr;\n" <<
+		"\t};\n\n" <<
+		"\t//Save & Load work on arrays of count components laid out contiguously\n" <<
+		"\tusing SaveFn = void(*)(const void* components, size_t count, std::vector<uint8_t>& out, const SerializationHooks& hooks);\n" <<
+		"\tusing LoadFn = void(*)(void* components, size_t count, const uint8_t*& in, const SerializationHooks& hooks);\n\n" <<
+		"\tinline void SaveString(const std::string& str, std::vector<uint8_t>& out)\n" <<
+		"\t{\n" <<
+		"\t\tconst uint32_t length = (uint32_t)str.size();\n" <<
+		"\t\tout.insert(out.end(), (const uint8_t*)&length, (const uint8_t*)&length + sizeof(length));\n" <<
+		"\t\tout.insert(out.end(), (const uint8_t*)str.data(), (const uint8_t*)str.data() + length);\n" <<
+		"\t}\n\n" <<
+		"\tinline void LoadString(std::string& str, const uint8_t*& in)\n" <<
+		"\t{\n" <<
+		"\t\tuint32_t length;\n" <<
+		"\t\tstd::memcpy(&length, in, sizeof(length));\n" <<
+		"\t\tstr.assign((const char*)in + sizeof(length), length);\n" <<
+		"\t\tin += sizeof(length) + length;\n" <<
+		"\t}\n\n" <<
+		"}\n";
+
+	os.rdbuf(Files.Append(mProjectDir / "Exports.cpp").rdbuf());
+	os << "\n\n";
+	for (const Object* obj : components)
+	{
+		const auto writename = exportname(*obj);
+		const size_t size = obj->Meta.Size;
+
+		//Fields that need more than a memcpy in order of their offset
+		std::vector<const Field*> others;
+		for (const auto& field : obj->Fields)
+		{
+			if (!isTriviallyCopyable(field.Meta.ValueType))
+				others.push_back(&field);
+		}
+		std::sort(others.begin(), others.end(), [](const Field* lhs, const Field* rhs) { return lhs->Offset < rhs->Offset; });
+		const auto ranges = PodRanges(*obj);
+
+		os << linkage(mOptions) << "void Save" << writename << "(const void* components, size_t count, std::vector<uint8_t>& out, const gtr::SerializationHooks& hooks)\n{\n" <<
+			"\tconst auto* base = static_cast<const uint8_t*>(components);\n";
+		if (isTriviallyCopyable(*obj))
+			os << "\tout.insert(out.end(), base, base + count * " << size << ");\n";
+		else
+		{
+			os << "\tfor (size_t i = 0; i < count; i++, base += " << size << ")\n\t{\n";
+			for (const auto& range : ranges)
+				os << "\t\tout.insert(out.end(), base + " << range.Offset << ", base + " << range.Offset + range.Size << ");\n";
+			for (const Field* field : others)
+			{
+				if (field->Meta.ValueType == FieldType::String)
+					os << "\t\tgtr::SaveString(*reinterpret_cast<const std::string*>(base + " << field->Offset << "), out);\n";
+				else if (field->Meta.ValueType == FieldType::Entity)
+					os << "\t\thooks.SaveEntity(hooks.User, base + " << field->Offset << ", out);\n";
+				else if (field->Meta.ValueType == FieldType::Asset)
+					os << "\t\thooks.SaveAsset(hooks.User, base + " << field->Offset << ", out);\n";
+			}
+			os << "\t}\n";
+		}
+		os << "}\n\n";
+
+		os << linkage(mOptions) << "void Load" << writename << "(void* components, size_t count, const uint8_t*& in, const gtr::SerializationHooks& hooks)\n{\n" <<
+			"\tauto* base = static_cast<uint8_t*>(components);\n";
+		if (isTriviallyCopyable(*obj))
+			os << "\tstd::memcpy(base, in, count * " << size << ");\n" <<
+				"\tin += count * " << size << ";\n";
+		else
+		{
+			os << "\tfor (size_t i = 0; i < count; i++, base += " << size << ")\n\t{\n";
+			for (const auto& range : ranges)
+				os << "\t\tstd::memcpy(base + " << range.Offset << ", in, " << range.Size << ");\n" <<
+					"\t\tin += " << range.Size << ";\n";
+			for (const Field* field : others)
+			{
+				if (field->Meta.ValueType == FieldType::String)
+					os << "\t\tgtr::LoadString(*reinterpret_cast<std::string*>(base + " << field->Offset << "), in);\n";
+				else if (field->Meta.ValueType == FieldType::Entity)
+					os << "\t\thooks.LoadEntity(hooks.User, base + " << field->Offset << ", in);\n";
+				else if (field->Meta.ValueType == FieldType::Asset)
+					os << "\t\thooks.LoadAsset(hooks.User, base + " << field->Offset << ", in);\n";
+			}
+			os << "\t}\n";
+		}
+		os << "}\n\n";
+	}
+}
+
+/**
+* @brief Writes an enumerator as a literal of the underlying type
+*/
+static void write_value(std::ostream& os, const Enum& enm, const EnumValue& value) noexcept
+{
+	if (enm.isUnsigned())
+		os << value.Uvalue << 'u';
+	else if (value.Value == INT64_MIN)
+		os << "(-" << INT64_MAX << " - 1)";
+	else
+		os << value.Value;
+}
+
+void PrebuildFinder::WriteEnumTables(void) noexcept
+{
+	//Sorted so that tables are written in the same order on every build
+	std::vector<const Enum*> enums;
+	std::set<std::string> headers;
+	for (const auto& [name, enm] : Enums)
+	{
+		enums.push_back(&enm);
+		if (!enm.Header.empty())
+			headers.insert(includepath(enm.Header));
+	}
+	std::sort(enums.begin(), enums.end(), [](const Enum* lhs, const Enum* rhs) { return lhs->Name < rhs->Name; });
+
+	Files.Append(mProjectDir / "Exports.h") << "#include \"EnumTables.h\"\n";
+
+	std::ostream os(Files.Write(mProjectDir / "EnumTables.h").rdbuf());
+	os << "// Auto generated by gtreflect.exe at " << Timestamp() <<
+		"#pragma once\n\n";
+	for (const auto& header : headers)
+		os << "#include <" << header << ">\n";
+	os << "#include <cstdint>\n" <<
+		"#include <string_view>\n" <<
+		"#include <type_traits>\n\n";
+	PerfectHash::WriteSource(os);
+	os << "namespace gtr {\n\n" <<
+		"\t//Specialized for every reflected enumeration, enumerators are sorted by value and then by name\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tstruct EnumTable;\n\n" <<
+		"\t//Position of the value on Values (the first one for values with more than one name), Count if it isn't an enumerator\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\t[[nodiscard]] constexpr uint32_t EnumIndex(T value) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tusing Table = EnumTable<T>;\n" <<
+		"\t\tconst auto raw = static_cast<typename Table::Type>(value);\n" <<
+		"\t\tif constexpr (Table::Dense)\n" <<
+		"\t\t{\n" <<
+		"\t\t\tif (raw < Table::Min || raw > Table::Max) return Table::Count;\n" <<
+		"\t\t\tconst uint32_t index = Table::Indices[raw - Table::Min];\n" <<
+		"\t\t\treturn index == UINT32_MAX ? Table::Count : index;\n" <<
+		"\t\t}\n" <<
+		"\t\telse\n" <<
+		"\t\t{\n" <<
+		"\t\t\tuint32_t first = 0, last = Table::Count;\n" <<
+		"\t\t\twhile (first < last)\n" <<
+		"\t\t\t{\n" <<
+		"\t\t\t\tconst uint32_t middle = first + (last - first) / 2;\n" <<
+		"\t\t\t\tif (Table::Values[middle] < raw) first = middle + 1;\n" <<
+		"\t\t\t\telse last = middle;\n" <<
+		"\t\t\t}\n" <<
+		"\t\t\treturn first < Table::Count && Table::Values[first] == raw ? first : Table::Count;\n" <<
+		"\t\t}\n" <<
+		"\t}\n\n" <<
+		"\t//Name of the enumerator, empty if there isn't one (the first name is returned for values with more than one)\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\t[[nodiscard]] constexpr std::string_view EnumToString(T value) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tconst uint32_t index = EnumIndex(value);\n" <<
+		"\t\treturn index < EnumTable<T>::Count ? EnumTable<T>::Names[index] : std::string_view();\n" <<
+		"\t}\n\n" <<
+		"\t//Value of the enumerator with the given name, false if there isn't one\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\t[[nodiscard]] constexpr bool EnumFromString(std::string_view name, T& value) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tusing Table = EnumTable<T>;\n" <<
+		"\t\tconst uint32_t index = Lookup(Table::Seeds, Table::Slots, Table::Count, name);\n" <<
+		"\t\tif (index >= Table::Count || Table::Names[index] != name) return false;\n" <<
+		"\t\tvalue = static_cast<T>(Table::Values[index]);\n" <<
+		"\t\treturn true;\n" <<
+		"\t}\n\n";
+
+	for (const Enum* enm : enums)
+	{
+		std::vector<std::pair<std::string, EnumValue>> entries(enm->Values.begin(), enm->Values.end());
+		const bool isUnsigned = enm->isUnsigned();
+		std::stable_sort(entries.begin(), entries.end(), [isUnsigned](const auto& lhs, const auto& rhs)
+		{
+			return isUnsigned ? lhs.second.Uvalue < rhs.second.Uvalue : lhs.second.Value < rhs.second.Value;
+		});
+		const uint32_t count = (uint32_t)entries.size();
+
+		//Name to value, slots point to the position on Names
+		std::vector<std::string> names;
+		for (const auto& [name, value] : entries)
+			names.push_back(name);
+		const std::string table = "s" + enm->Name;
+		PerfectHash::Build(names).WriteTables(os, table);
+
+		//Value to name is a direct index when at least half of the values in the range are in use
+		const uint64_t span = count ? entries.back().second.Uvalue - entries.front().second.Uvalue : 0;
+		const bool dense = count && span < 2 * (uint64_t)count;
+
+		os << "\ttemplate<> struct EnumTable<" << enm->Name << "> {\n" <<
+			"\t\tusing Type = std::underlying_type_t<" << enm->Name << ">;\n" <<
+			"\t\tstatic constexpr std::string_view Name = \"" << enm->Meta.Name << "\";\n" <<
+			"\t\tstatic constexpr uint32_t Count = " << count << ";\n" <<
+			"\t\tstatic constexpr std::string_view Names[] = { ";
+		for (uint32_t i = 0; i < count; i++)
+			os << (i == 0 ? "\"" : ", \"") << entries[i].first << '"';
+		os << (count ? "" : "\"\"") << " };\n" <<
+			"\t\tstatic constexpr Type Values[] = { ";
+		for (uint32_t i = 0; i < count; i++)
+		{
+			os << (i == 0 ? "" : ", ");
+			write_value(os, *enm, entries[i].second);
+		}
+		os << (count ? "" : "0") << " };\n" <<
+			"\t\tstatic constexpr const uint32_t* Seeds = " << table << "Seeds;\n" <<
+			"\t\tstatic constexpr const uint32_t* Slots = " << table << "Slots;\n" <<
+			"\t\tstatic constexpr bool Dense = " << (dense ? "true" : "false") << ";\n";
+		if (dense)
+		{
+			os << "\t\tstatic constexpr Type Min = ";
+			write_value(os, *enm, entries.front().second);
+			os << ";\n\t\tstatic constexpr Type Max = ";
+			write_value(os, *enm, entries.back().second);
+			os << ";\n\t\tstatic constexpr uint32_t Indices[] = { ";
+
+			//Values with more than one name point to the first one
+			std::vector<uint32_t> indices(span + 1, UINT32_MAX);
+			for (uint32_t i = count; i-- > 0;)
+				indices[entries[i].second.Uvalue - entries.front().second.Uvalue] = i;
+			for (size_t i = 0; i < indices.size(); i++)
+			{
+				os << (i == 0 ? "" : ", ");
+				if (indices[i] == UINT32_MAX)
+					os << "UINT32_MAX";
+				else
+					os << indices[i];
+			}
+			os << " };\n";
+		}
+		os << "\t};\n\n";
+	}
+	os << "}\n";
+}
+
+/**
+* @brief Number of bits needed to write every value in [0, value]
+*/
+[[nodiscard]] static uint32_t bitwidth(uint64_t value) noexcept
+{
+	uint32_t bits = 0;
+	for (; value; value >>= 1)
+		bits++;
+	return bits;
+}
+
+/**
+* @brief Writes a double literal that keeps every bit of the value
+*/
+[[nodiscard]] static std::string literal(double value) noexcept
+{
+	std::ostringstream os;
+	os << std::setprecision(17) << value;
+	const auto str = os.str();
+	return str.find_first_of(".en") == std::string::npos ? str + ".0" : str;
+}
+
+/**
+* @brief How a scalar (or a component of a vec) is written on the quantized stream
+* @details Encode is an uint64_t expression of the value at ptr and Decode stores value at ptr,
+*	values that quantize to the same integer are considered equal for delta encoding.
+*/
+struct Quantized {
+	std::string Encode;
+	std::string Decode;
+	uint32_t Bits = 0;
+};
+
+[[nodiscard]] static Quantized quantize_int(const char* type, size_t size, bool isSigned, const FieldMetadata& meta, const std::string& ptr) noexcept
+{
+	const std::string read = "gtr::ReadAs<" + std::string(type) + ">(" + ptr + ")";
+	const bool bounded = isSigned ? meta.MinInt < meta.MaxInt : meta.MinUint < meta.MaxUint;
+	if (!bounded)
+		return { "(uint64_t)" + read, "gtr::WriteAs<" + std::string(type) + ">(" + ptr + ", (" + type + ")value)", (uint32_t)size * 8 };
+
+	//Values are clamped to the bounds and written as their distance to min, which only fits on unsigned arithmetic
+	if (isSigned)
+	{
+		const auto min = meta.MinInt == INT64_MIN ? "(-" + std::to_string(INT64_MAX) + " - 1)" : std::to_string(meta.MinInt);
+		const auto max = std::to_string(meta.MaxInt);
+		return { "gtr::QuantizeInt(" + read + ", " + min + ", " + max + ")",
+			"gtr::WriteAs<" + std::string(type) + ">(" + ptr + ", (" + type + ")(int64_t)(value + (uint64_t)" + min + "))",
+			bitwidth((uint64_t)meta.MaxInt - (uint64_t)meta.MinInt) };
+	}
+	const auto min = std::to_string(meta.MinUint), max = std::to_string(meta.MaxUint);
+	return { "gtr::QuantizeUint(" + read + ", " + min + "u, " + max + "u)",
+		"gtr::WriteAs<" + std::string(type) + ">(" + ptr + ", (" + type + ")(value + " + min + "u))",
+		bitwidth(meta.MaxUint - meta.MinUint) };
+}
+
+[[nodiscard]] static Quantized quantize_float(bool isDouble, const Field& field, const std::string& ptr) noexcept
+{
+	const char* type = isDouble ? "double" : "float";
+	const char* raw = isDouble ? "uint64_t" : "uint32_t";
+	const uint32_t rawbits = isDouble ? 64 : 32;
+
+	//Without bounds and precision the bits of the float are written as they are
+	const auto& meta = field.Meta;
+	const double steps = field.Precision > 0.0 && meta.MinFloat < meta.MaxFloat ? std::ceil((meta.MaxFloat - meta.MinFloat) / field.Precision) : 0.0;
+	if (!(steps > 0.0 && steps < 18446744073709551616.0) || bitwidth((uint64_t)steps) >= rawbits)
+		return { "(uint64_t)gtr::ReadAs<" + std::string(raw) + ">(" + ptr + ")", "gtr::WriteAs<" + std::string(raw) + ">(" + ptr + ", (" + raw + ")value)", rawbits };
+
+	const auto args = literal(meta.MinFloat) + ", " + literal(meta.MaxFloat) + ", " + literal(field.Precision);
+	return { "gtr::QuantizeFloat(gtr::ReadAs<" + std::string(type) + ">(" + ptr + "), " + args + ")",
+		"gtr::WriteAs<" + std::string(type) + ">(" + ptr + ", (" + type + ")gtr::DequantizeFloat(value, " + args + "))",
+		bitwidth((uint64_t)steps) };
+}
+
+/**
+* @brief Scalars that make up a numeric field, empty for enums, strings, entities & assets
+*/
+[[nodiscard]] static std::vector<Quantized> quantize(const Field& field, const std::string& ptr) noexcept
+{
+	switch (field.Meta.ValueType)
+	{
+	case FieldType::Bool:		return { { "(uint64_t)gtr::ReadAs<bool>(" + ptr + ")", "gtr::WriteAs<bool>(" + ptr + ", value != 0)", 1 } };
+	case FieldType::Char:		return { quantize_int("int8_t", 1, true, field.Meta, ptr) };
+	case FieldType::Int16:		return { quantize_int("int16_t", 2, true, field.Meta, ptr) };
+	case FieldType::Int32:		return { quantize_int("int32_t", 4, true, field.Meta, ptr) };
+	case FieldType::Int64:		return { quantize_int("int64_t", 8, true, field.Meta, ptr) };
+	case FieldType::Byte:		return { quantize_int("uint8_t", 1, false, field.Meta, ptr) };
+	case FieldType::Uint16:		return { quantize_int("uint16_t", 2, false, field.Meta, ptr) };
+	case FieldType::Uint32:		return { quantize_int("uint32_t", 4, false, field.Meta, ptr) };
+	case FieldType::Uint64:		return { quantize_int("uint64_t", 8, false, field.Meta, ptr) };
+	case FieldType::Float32:	return { quantize_float(false, field, ptr) };
+	case FieldType::Float64:	return { quantize_float(true, field, ptr) };
+	case FieldType::Vec2:
+	case FieldType::Vec3:
+	case FieldType::Vec4:
+	{
+		//Bounds & precision apply to every component
+		std::vector<Quantized> scalars;
+		for (size_t i = 0; i < field.Meta.Size / sizeof(float); i++)
+			scalars.push_back(quantize_float(false, field, ptr + " + " + std::to_string(i * sizeof(float))));
+		return scalars;
+	}
+	default:
+		return {};
+	}
+}
+
+[[nodiscard]] static bool isEnum(FieldType type) noexcept
+{
+	return type >= FieldType::Enum_Char && type <= FieldType::Enum_Uint64;
+}
+
+void PrebuildFinder::WriteQuantizedSerializers(void) noexcept
+{
+	const auto components = gather(Objects, ReflectionType::Component);
+
+	std::ostream os(Files.Append(mProjectDir / "Exports.h").rdbuf());
+	os << "\n#include <type_traits>\n\n" <<
+		"namespace gtr {\n\n" <<
+		"\t//Quantized Save & Load, fields that are the same as on baseline (count components or nullptr) are written as a single bit\n" <<
+		"\tusing SaveQuantizedFn = void(*)(const void* components, const void* baseline, size_t count, std::vector<uint8_t>& out, const SerializationHooks& hooks);\n" <<
+		"\tusing LoadQuantizedFn = void(*)(void* components, const void* baseline, size_t count, const uint8_t*& in, const SerializationHooks& hooks);\n\n" <<
+		"\t//Bits are written from the least significant one, strings, entities & assets start on a new byte\n" <<
+		"\tstruct BitWriter {\n" <<
+		"\t\tstd::vector<uint8_t>& Out;\n" <<
+		"\t\tuint32_t Used = 0;//Bits in use on the last byte of Out, 0 when the next bit needs a new one\n\n" <<
+		"\t\tvoid Write(uint64_t value, uint32_t bits) noexcept\n" <<
+		"\t\t{\n" <<
+		"\t\t\twhile (bits > 0)\n" <<
+		"\t\t\t{\n" <<
+		"\t\t\t\tif (Used == 0) Out.push_back(0);\n" <<
+		"\t\t\t\tconst uint32_t count = bits < 8 - Used ? bits : 8 - Used;\n" <<
+		"\t\t\t\tOut.back() |= (uint8_t)((value & ((1u << count) - 1)) << Used);\n" <<
+		"\t\t\t\tvalue >>= count;\n" <<
+		"\t\t\t\tbits -= count;\n" <<
+		"\t\t\t\tUsed = (Used + count) & 7;\n" <<
+		"\t\t\t}\n" <<
+		"\t\t}\n\n" <<
+		"\t\tvoid Align(void) noexcept { Used = 0; }\n" <<
+		"\t};\n\n" <<
+		"\tstruct BitReader {\n" <<
+		"\t\tconst uint8_t*& In;\n" <<
+		"\t\tuint32_t Used = 0;//Bits already read from *In\n\n" <<
+		"\t\t[[nodiscard]] uint64_t Read(uint32_t bits) noexcept\n" <<
+		"\t\t{\n" <<
+		"\t\t\tuint64_t value = 0;\n" <<
+		"\t\t\tfor (uint32_t shift = 0; shift < bits;)\n" <<
+		"\t\t\t{\n" <<
+		"\t\t\t\tconst uint32_t count = bits - shift < 8 - Used ? bits - shift : 8 - Used;\n" <<
+		"\t\t\t\tvalue |= (uint64_t)((*In >> Used) & ((1u << count) - 1)) << shift;\n" <<
+		"\t\t\t\tshift += count;\n" <<
+		"\t\t\t\tUsed += count;\n" <<
+		"\t\t\t\tif (Used == 8) { In++; Used = 0; }\n" <<
+		"\t\t\t}\n" <<
+		"\t\t\treturn value;\n" <<
+		"\t\t}\n\n" <<
+		"\t\tvoid Align(void) noexcept { if (Used) { In++; Used = 0; } }\n" <<
+		"\t};\n\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\t[[nodiscard]] inline T ReadAs(const uint8_t* ptr) noexcept { T value; std::memcpy(&value, ptr, sizeof(T)); return value; }\n\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tinline void WriteAs(uint8_t* ptr, T value) noexcept { std::memcpy(ptr, &value, sizeof(T)); }\n\n" <<
+		"\t[[nodiscard]] inline uint64_t QuantizeInt(int64_t value, int64_t min, int64_t max) noexcept { return (uint64_t)(value < min ? min : (value > max ? max : value)) - (uint64_t)min; }\n" <<
+		"\t[[nodiscard]] inline uint64_t QuantizeUint(uint64_t value, uint64_t min, uint64_t max) noexcept { return (value < min ? min : (value > max ? max : value)) - min; }\n\n" <<
+		"\t//Steps of the given size from min, NaN is written as min\n" <<
+		"\t[[nodiscard]] inline uint64_t QuantizeFloat(double value, double min, double max, double step) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tvalue = !(value > min) ? min : (value > max ? max : value);\n" <<
+		"\t\treturn (uint64_t)((value - min) / step + 0.5);\n" <<
+		"\t}\n\n" <<
+		"\t[[nodiscard]] inline double DequantizeFloat(uint64_t value, double min, double max, double step) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tconst double result = min + (double)value * step;\n" <<
+		"\t\treturn result > max ? max : result;\n" <<
+		"\t}\n\n" <<
+		"\t[[nodiscard]] constexpr uint32_t BitWidth(uint64_t value) noexcept { return value ? 1 + BitWidth(value >> 1) : 0; }\n\n" <<
+		"\t//Enumerators are written as their position on EnumTable, followed by the whole value when it isn't one\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tinline void WriteEnum(BitWriter& writer, T value) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tconst uint32_t index = EnumIndex(value);\n" <<
+		"\t\twriter.Write(index, BitWidth(EnumTable<T>::Count));\n" <<
+		"\t\tif (index == EnumTable<T>::Count) writer.Write((uint64_t)static_cast<std::underlying_type_t<T>>(value), sizeof(T) * 8);\n" <<
+		"\t}\n\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\t[[nodiscard]] inline T ReadEnum(BitReader& reader) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tconst uint64_t index = reader.Read(BitWidth(EnumTable<T>::Count));\n" <<
+		"\t\tif (index < EnumTable<T>::Count) return static_cast<T>(EnumTable<T>::Values[index]);\n" <<
+		"\t\treturn static_cast<T>(static_cast<std::underlying_type_t<T>>(reader.Read(sizeof(T) * 8)));\n" <<
+		"\t}\n\n" <<
+		"\t//Writes whether the field changed from the baseline, fields are always written without one\n" <<
+		"\t[[nodiscard]] inline bool WriteChanged(BitWriter& writer, bool hasBaseline, bool changed) noexcept\n" <<
+		"\t{\n" <<
+		"\t\tif (hasBaseline) writer.Write(changed, 1);\n" <<
+		"\t\treturn !hasBaseline || changed;\n" <<
+		"\t}\n\n" <<
+		"\t[[nodiscard]] inline bool ReadChanged(BitReader& reader, bool hasBaseline) noexcept { return !hasBaseline || reader.Read(1) != 0; }\n\n" <<
+		"}\n";
+
+	os.rdbuf(Files.Append(mProjectDir / "Exports.cpp").rdbuf());
+	for (const Object* obj : components)
+	{
+		const auto writename = exportname(*obj);
+		const size_t size = obj->Meta.Size;
+
+		std::vector<const Field*> fields;
+		for (const auto& field : obj->Fields)
+			fields.push_back(&field);
+		std::sort(fields.begin(), fields.end(), [](const Field* lhs, const Field* rhs) { return lhs->Offset < rhs->Offset; });
+
+		os << linkage(mOptions) << "void SaveQuantized" << writename << "(const void* components, const void* baseline, size_t count, std::vector<uint8_t>& out, const gtr::SerializationHooks& hooks)\n{\n" <<
+			"\tconst auto* base = static_cast<const uint8_t*>(components);\n" <<
+			"\tconst auto* prev = static_cast<const uint8_t*>(baseline);\n" <<
+			"\tgtr::BitWriter writer{ out };\n" <<
+			"\tfor (size_t i = 0; i < count; i++, base += " << size << ", prev += prev ? " << size << " : 0)\n\t{\n";
+		for (const Field* field : fields)
+		{
+			const auto offset = std::to_string(field->Offset);
+			const auto type = field->Meta.ValueType;
+			os << "\t\t//" << field->Name << '\n';
+			if (type == FieldType::Entity || type == FieldType::Asset)
+			{
+				//Handles are opaque, so they can't be compared with the baseline
+				os << "\t\twriter.Align();\n" <<
+					"\t\thooks.Save" << (type == FieldType::Entity ? "Entity" : "Asset") << "(hooks.User, base + " << offset << ", out);\n";
+			}
+			else if (type == FieldType::String)
+			{
+				const auto str = [&offset](const char* ptr) { return "*reinterpret_cast<const std::string*>(" + std::string(ptr) + " + " + offset + ")"; };
+				os << "\t\tif (gtr::WriteChanged(writer, prev, prev && " << str("base") << " != " << str("prev") << "))\n\t\t{\n" <<
+					"\t\t\twriter.Align();\n" <<
+					"\t\t\tgtr::SaveString(" << str("base") << ", out);\n" <<
+					"\t\t}\n";
+			}
+			else if (isEnum(type))
+			{
+				const auto value = [&](const char* ptr) { return "gtr::ReadAs<" + field->TypeName + ">(" + ptr + " + " + offset + ")"; };
+				os << "\t\tif (gtr::WriteChanged(writer, prev, prev && " << value("base") << " != " << value("prev") << "))\n" <<
+					"\t\t\tgtr::WriteEnum(writer, " << value("base") << ");\n";
+			}
+			else
+			{
+				const auto scalars = quantize(*field, "base + " + offset);
+				const auto previous = quantize(*field, "prev + " + offset);
+				os << "\t\tif (gtr::WriteChanged(writer, prev, prev && (";
+				for (size_t i = 0; i < scalars.size(); i++)
+					os << (i ? " || " : "") << scalars[i].Encode << " != " << previous[i].Encode;
+				os << ")))\n\t\t{\n";
+				for (const auto& scalar : scalars)
+					os << "\t\t\twriter.Write(" << scalar.Encode << ", " << scalar.Bits << ");\n";
+				os << "\t\t}\n";
+			}
+		}
+		os << "\t}\n" <<
+			"}\n\n";
+
+		os << linkage(mOptions) << "void LoadQuantized" << writename << "(void* components, const void* baseline, size_t count, const uint8_t*& in, const gtr::SerializationHooks& hooks)\n{\n" <<
+			"\tauto* base = static_cast<uint8_t*>(components);\n" <<
+			"\tconst auto* prev = static_cast<const uint8_t*>(baseline);\n" <<
+			"\tgtr::BitReader reader{ in };\n" <<
+			"\tfor (size_t i = 0; i < count; i++, base += " << size << ", prev += prev ? " << size << " : 0)\n\t{\n";
+		for (const Field* field : fields)
+		{
+			const auto offset = std::to_string(field->Offset);
+			const auto type = field->Meta.ValueType;
+			os << "\t\t//" << field->Name << '\n';
+			if (type == FieldType::Entity || type == FieldType::Asset)
+			{
+				os << "\t\treader.Align();\n" <<
+					"\t\thooks.Load" << (type == FieldType::Entity ? "Entity" : "Asset") << "(hooks.User, base + " << offset << ", in);\n";
+				continue;
+			}
+
+			os << "\t\tif (gtr::ReadChanged(reader, prev))\n";
+			if (type == FieldType::String)
+			{
+				os << "\t\t{\n" <<
+					"\t\t\treader.Align();\n" <<
+					"\t\t\tgtr::LoadString(*reinterpret_cast<std::string*>(base + " << offset << "), in);\n" <<
+					"\t\t}\n" <<
+					"\t\telse\n" <<
+					"\t\t\t*reinterpret_cast<std::string*>(base + " << offset << ") = *reinterpret_cast<const std::string*>(prev + " << offset << ");\n";
+				continue;
+			}
+			if (isEnum(type))
+				os << "\t\t\tgtr::WriteAs<" << field->TypeName << ">(base + " << offset << ", gtr::ReadEnum<" << field->TypeName << ">(reader));\n";
+			else
+			{
+				os << "\t\t{\n";
+				for (const auto& scalar : quantize(*field, "base + " + offset))
+					os << "\t\t\t{ const uint64_t value = reader.Read(" << scalar.Bits << "); " << scalar.Decode << "; }\n";
+				os << "\t\t}\n";
+			}
+			os << "\t\telse\n" <<
+				"\t\t\tstd::memcpy(base + " << offset << ", prev + " << offset << ", " << field->Meta.Size << ");\n";
+		}
+		os << "\t}\n" <<
+			"\treader.Align();\n" <<
+			"}\n\n";
+	}
+}
+
+void PrebuildFinder::WriteDirtyTracking(void) noexcept
+{
+	std::vector<const Object*> tracked;
+	for (const Object* obj : gather(Objects, ReflectionType::Component))
+	{
+		if (obj->TrackChanges)
+			tracked.push_back(obj);
+	}
+
+	std::ostream os(Files.Append(mProjectDir / "Exports.h").rdbuf());
+	os << "\n#if defined(_MSC_VER)\n" <<
+		"#include <intrin.h>\n" <<
+		"#endif\n\n" <<
+		"namespace gtr {\n\n" <<
+		"\t[[nodiscard]] inline uint32_t CountTrailingZeros(uint64_t word) noexcept\n" <<
+		"\t{\n" <<
+		"#if defined(_MSC_VER)\n" <<
+		"\t\tunsigned long index;\n" <<
+		"\t\t_BitScanForward64(&index, word);\n" <<
+		"\t\treturn (uint32_t)index;\n" <<
+		"#else\n" <<
+		"\t\treturn (uint32_t)__builtin_ctzll(word);\n" <<
+		"#endif\n" <<
+		"\t}\n\n" <<
+		"\t//Bit i stands for the i-th field of the component, in the same order as on its Native-Script Asset\n" <<
+		"\ttemplate<uint32_t N>\n" <<
+		"\tstruct DirtyMask {\n" <<
+		"\t\tstatic constexpr uint32_t WordCount = (N + 63) / 64;\n" <<
+		"\t\tuint64_t Words[WordCount] = {};\n\n" <<
+		"\t\tvoid Set(uint32_t field) noexcept { Words[field / 64] |= 1ull << (field % 64); }\n" <<
+		"\t\t[[nodiscard]] bool Test(uint32_t field) const noexcept { return (Words[field / 64] >> (field % 64)) & 1; }\n" <<
+		"\t\t[[nodiscard]] bool Any(void) const noexcept { for (const uint64_t word : Words) if (word) return true; return false; }\n" <<
+		"\t\tvoid Clear(void) noexcept { for (uint64_t& word : Words) word = 0; }\n\n" <<
+		"\t\t//Calls fn with the index of every dirty field in order\n" <<
+		"\t\ttemplate<typename Fn>\n" <<
+		"\t\tvoid ForEach(Fn&& fn) const\n" <<
+		"\t\t{\n" <<
+		"\t\t\tfor (uint32_t i = 0; i < WordCount; i++)\n" <<
+		"\t\t\t\tfor (uint64_t word = Words[i]; word; word &= word - 1)\n" <<
+		"\t\t\t\t\tfn(i * 64 + CountTrailingZeros(word));\n" <<
+		"\t\t}\n" <<
+		"\t};\n\n" <<
+		"\t//Fields of a component that tracks changes, indexed like its DirtyMask, so the Engine can walk them without knowing the type\n" <<
+		"\tstruct DirtyLayout { uint32_t FieldCount; uint32_t WordCount; const uint32_t* Offsets; const uint32_t* Sizes; };\n\n" <<
+		"\t//Specialized for every component with dirty=true, Set* only marks fields that change\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tstruct Tracked;\n\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\t[[nodiscard]] inline Tracked<T> Track(T& component, typename Tracked<T>::Mask& dirty) noexcept { return { component, dirty }; }\n\n";
+
+	for (const Object* obj : tracked)
+	{
+		//A mask of no fields would be an array of no words, which isn't valid C++
+		const auto& name = obj->Name;
+		const size_t count = obj->Fields.size();
+		GTR_ASSERT(count > 0, "'%s' has dirty=true but no reflected fields to track.\n", name.c_str());
+		os << "\ttemplate<> struct Tracked<" << name << "> {\n" <<
+			"\t\tstatic constexpr uint32_t FieldCount = " << count << ";\n" <<
+			"\t\tusing Mask = DirtyMask<FieldCount>;\n" <<
+			"\t\tstruct Fields { enum : uint32_t { ";
+		for (size_t i = 0; i < count; i++)
+			os << (i ? ", " : "") << obj->Fields[i].Name << " = " << i;
+		os << " }; };\n" <<
+			"\t\tstatic constexpr uint32_t Offsets[] = { ";
+		for (size_t i = 0; i < count; i++)
+			os << (i ? ", " : "") << obj->Fields[i].Offset;
+		os << " };\n" <<
+			"\t\tstatic constexpr uint32_t Sizes[] = { ";
+		for (size_t i = 0; i < count; i++)
+			os << (i ? ", " : "") << obj->Fields[i].Meta.Size;
+		os << " };\n" <<
+			"\t\tstatic constexpr DirtyLayout Layout = { FieldCount, Mask::WordCount, Offsets, Sizes };\n\n";
+		os << "\t\t" << name << "& Component;\n" <<
+			"\t\tMask& Dirty;\n\n";
+		for (const auto& field : obj->Fields)
+		{
+			//Entities can't be compared, so they are marked on every Set
+			const auto& member = field.Name;
+			const auto type = "decltype(" + name + "::" + member + ")";
+			const char* except = field.Meta.ValueType == FieldType::String || field.Meta.ValueType == FieldType::Asset ? "" : " noexcept";
+			os << "\t\t[[nodiscard]] const " << type << "& Get" << member << "(void) const noexcept { return Component." << member << "; }\n" <<
+				"\t\t[[nodiscard]] " << type << "& Edit" << member << "(void) noexcept { Dirty.Set(Fields::" << member << "); return Component." << member << "; }\n";
+			if (field.Meta.ValueType == FieldType::Entity)
+				os << "\t\tvoid Set" << member << "(const " << type << "& value)" << except << " { Component." << member << " = value; Dirty.Set(Fields::" << member << "); }\n";
+			else
+				os << "\t\tvoid Set" << member << "(const " << type << "& value)" << except << " { if (!(Component." << member << " == value)) { Component." << member << " = value; Dirty.Set(Fields::" << member << "); } }\n";
+		}
+		os << "\t};\n\n";
+	}
+	os << "}\n";
+
+	//Without the registry the Engine finds the layouts by name
+	if (mOptions.Registry)
+		return;
+	os.rdbuf(Files.Append(mProjectDir / "Exports.cpp").rdbuf());
+	for (const Object* obj : tracked)
+		os << linkage(mOptions) << "const gtr::DirtyLayout* GetDirtyLayout" << exportname(*obj) << "(void) { return &gtr::Tracked<" << obj->Name << ">::Layout; }\n";
+	if (!tracked.empty())
+		os << '\n';
+}
+
+void PrebuildFinder::WriteReferences(void) noexcept
+{
+	std::ostream os(Files.Append(mProjectDir / "Exports.h").rdbuf());
+	os << "\nnamespace gtr {\n\n" <<
+		"\t//Sorted offsets of the Entity & Asset fields of an object, nullptr when there aren't any\n" <<
+		"\tstruct ReferenceLayout { uint32_t EntityCount; uint32_t AssetCount; const uint32_t* Entities; const uint32_t* Assets; };\n\n" <<
+		"\t//Specialized for every reflected object\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tstruct References;\n\n" <<
+		"\t//Calls fn with a pointer to every reference of the object\n" <<
+		"\ttemplate<typename Fn>\n" <<
+		"\tinline void ForEachReference(void* object, uint32_t count, const uint32_t* offsets, Fn&& fn)\n" <<
+		"\t{\n" <<
+		"\t\tfor (uint32_t i = 0; i < count; i++)\n" <<
+		"\t\t\tfn(static_cast<uint8_t*>(object) + offsets[i]);\n" <<
+		"\t}\n\n";
+
+	auto write_array = [&os](const char* name, const std::vector<size_t>& offsets)
+	{
+		if (offsets.empty())
+			return;
+		os << "\t\tstatic constexpr uint32_t " << name << "[] = { ";
+		for (size_t i = 0; i < offsets.size(); i++)
+			os << (i ? ", " : "") << offsets[i];
+		os << " };\n";
+	};
+
+	//Only objects with references are exported, the Engine takes a missing one as empty
+	std::vector<const Object*> exported;
+	for (const ReflectionType type : { ReflectionType::Component, ReflectionType::Object, ReflectionType::System })
+	{
+		for (const Object* obj : gather(Objects, type))
+		{
+			const ReferenceOffsets references = GatherReferences(*obj);
+			os << "\ttemplate<> struct References<" << obj->Name << "> {\n";
+			write_array("Entities", references.Entities);
+			write_array("Assets", references.Assets);
+			os << "\t\tstatic constexpr ReferenceLayout Layout = { " << references.Entities.size() << ", " << references.Assets.size() << ", " <<
+				(references.Entities.empty() ? "nullptr" : "Entities") << ", " << (references.Assets.empty() ? "nullptr" : "Assets") << " };\n" <<
+				"\t};\n\n";
+			if (!references.Entities.empty() || !references.Assets.empty())
+				exported.push_back(obj);
+		}
+	}
+	os << "}\n";
+
+	if (mOptions.Registry)
+		return;
+	os.rdbuf(Files.Append(mProjectDir / "Exports.cpp").rdbuf());
+	for (const Object* obj : exported)
+		os << linkage(mOptions) << "const gtr::ReferenceLayout* GetReferences" << exportname(*obj) << "(void) { return &gtr::References<" << obj->Name << ">::Layout; }\n";
+	if (!exported.empty())
+		os << '\n';
+}
+
+void PrebuildFinder::WriteColumnar(void) noexcept
+{
+	//Members of gtr::SoA<T> that fields can't share a name with
+	static const std::set<std::string> reserved = { "Cold", "Colds", "Ref", "Size", "Reserve", "Push", "SwapRemove", "Get", "Set", "FieldCount", "Offsets", "Sizes", "ColdOffsets", "Layout" };
+
+	std::vector<const Object*> columnar;
+	for (const Object* obj : gather(Objects, ReflectionType::Component))
+	{
+		const bool split = std::any_of(obj->Fields.begin(), obj->Fields.end(), [](const Field& field) { return field.Hot; });
+		GTR_ASSERT(obj->Columnar || !split, "split is only valid on components with soa=true, check the fields of '%s'.\n", obj->Name.c_str());
+		if (obj->Columnar)
+			columnar.push_back(obj);
+	}
+
+	std::ostream os(Files.Append(mProjectDir / "Exports.h").rdbuf());
+	os << "\n#include <cstddef>\n" <<
+		"#include <new>\n" <<
+		"#include <utility>\n\n" <<
+		"namespace gtr {\n\n" <<
+		"\t//Contiguous array that starts on a cache line, so loops over it can be vectorized\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tclass Column {\n" <<
+		"\tpublic:\n" <<
+		"\t\tColumn(void) = default;\n" <<
+		"\t\tColumn(const Column&) = delete;\n" <<
+		"\t\tColumn& operator=(const Column&) = delete;\n" <<
+		"\t\t~Column(void) { Clear(); ::operator delete(mData, std::align_val_t(Alignment)); }\n\n" <<
+		"\t\t[[nodiscard]] T* Data(void) noexcept { return mData; }\n" <<
+		"\t\t[[nodiscard]] const T* Data(void) const noexcept { return mData; }\n" <<
+		"\t\t[[nodiscard]] size_t Size(void) const noexcept { return mSize; }\n" <<
+		"\t\t[[nodiscard]] T& operator[](size_t index) noexcept { return mData[index]; }\n" <<
+		"\t\t[[nodiscard]] const T& operator[](size_t index) const noexcept { return mData[index]; }\n\n" <<
+		"\t\tvoid Reserve(size_t capacity)\n" <<
+		"\t\t{\n" <<
+		"\t\t\tif (capacity <= mCapacity) return;\n" <<
+		"\t\t\tT* data = static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(Alignment)));\n" <<
+		"\t\t\tfor (size_t i = 0; i < mSize; i++)\n" <<
+		"\t\t\t{\n" <<
+		"\t\t\t\tnew (data + i) T(std::move(mData[i]));\n" <<
+		"\t\t\t\tmData[i].~T();\n" <<
+		"\t\t\t}\n" <<
+		"\t\t\t::operator delete(mData, std::align_val_t(Alignment));\n" <<
+		"\t\t\tmData = data;\n" <<
+		"\t\t\tmCapacity = capacity;\n" <<
+		"\t\t}\n\n" <<
+		"\t\tvoid Push(const T& value)\n" <<
+		"\t\t{\n" <<
+		"\t\t\tif (mSize == mCapacity) Reserve(mCapacity ? 2 * mCapacity : 16);\n" <<
+		"\t\t\tnew (mData + mSize) T(value);\n" <<
+		"\t\t\tmSize++;\n" <<
+		"\t\t}\n\n" <<
+		"\t\t//Moves the last element over the removed one\n" <<
+		"\t\tvoid SwapRemove(size_t index) noexcept\n" <<
+		"\t\t{\n" <<
+		"\t\t\tif (index + 1 != mSize) mData[index] = std::move(mData[mSize - 1]);\n" <<
+		"\t\t\tmData[--mSize].~T();\n" <<
+		"\t\t}\n\n" <<
+		"\t\tvoid Clear(void) noexcept\n" <<
+		"\t\t{\n" <<
+		"\t\t\tfor (size_t i = 0; i < mSize; i++) mData[i].~T();\n" <<
+		"\t\t\tmSize = 0;\n" <<
+		"\t\t}\n\n" <<
+		"\tprivate:\n" <<
+		"\t\tstatic constexpr size_t Alignment = alignof(T) > 64 ? alignof(T) : 64;\n" <<
+		"\t\tT* mData = nullptr;\n" <<
+		"\t\tsize_t mSize = 0;\n" <<
+		"\t\tsize_t mCapacity = 0;\n" <<
+		"\t};\n\n" <<
+		"\t//Offsets & Sizes are of every field on the component, ColdOffsets is where cold fields are on the Cold block (UINT32_MAX for hot fields)\n" <<
+		"\tstruct SoALayout { uint32_t FieldCount; uint32_t ColdSize; const uint32_t* Offsets; const uint32_t* Sizes; const uint32_t* ColdOffsets; };\n\n" <<
+		"\t//Specialized for every component with soa=true, hot fields get a Column each and the rest share a Column of Cold blocks\n" <<
+		"\ttemplate<typename T>\n" <<
+		"\tstruct SoA;\n\n";
+
+	for (const Object* obj : columnar)
+	{
+		const auto& name = obj->Name;
+		GTR_ASSERT(!obj->Fields.empty(), "Component '%s' with soa=true should have at least one field.\n", name.c_str());
+
+		//Without any split=hot every field is hot
+		const bool split = std::any_of(obj->Fields.begin(), obj->Fields.end(), [](const Field& field) { return field.Hot; });
+		std::vector<const Field*> hot, cold;
+		for (const auto& field : obj->Fields)
+		{
+			GTR_ASSERT(reserved.find(field.Name) == reserved.end(), "Field '%s' of '%s' has the same name as a member of gtr::SoA.\n", field.Name.c_str(), name.c_str());
+			(field.Hot || !split ? hot : cold).push_back(&field);
+		}
+		const auto type = [&name](const Field* field) { return "decltype(" + name + "::" + field->Name + ")"; };
+
+		os << "\ttemplate<> struct SoA<" << name << "> {\n";
+		if (!cold.empty())
+		{
+			os << "\t\tstruct Cold {\n";
+			for (const Field* field : cold)
+				os << "\t\t\t" << type(field) << ' ' << field->Name << ";\n";
+			os << "\t\t};\n\n";
+		}
+		for (const Field* field : hot)
+			os << "\t\tColumn<" << type(field) << "> " << field->Name << ";\n";
+		if (!cold.empty())
+			os << "\t\tColumn<Cold> Colds;\n";
+
+		//Metadata in the order of the fields of the asset
+		const size_t count = obj->Fields.size();
+		os << "\n\t\tstatic constexpr uint32_t FieldCount = " << count << ";\n" <<
+			"\t\tstatic constexpr uint32_t Offsets[] = { ";
+		for (size_t i = 0; i < count; i++)
+			os << (i ? ", " : "") << obj->Fields[i].Offset;
+		os << " };\n" <<
+			"\t\tstatic constexpr uint32_t Sizes[] = { ";
+		for (size_t i = 0; i < count; i++)
+			os << (i ? ", " : "") << obj->Fields[i].Meta.Size;
+		os << " };\n" <<
+			"\t\tstatic constexpr uint32_t ColdOffsets[] = { ";
+		for (size_t i = 0; i < count; i++)
+		{
+			const bool isHot = obj->Fields[i].Hot || !split;
+			os << (i ? ", " : "") << (isHot ? "UINT32_MAX" : "(uint32_t)offsetof(Cold, " + obj->Fields[i].Name + ")");
+		}
+		os << " };\n" <<
+			"\t\tstatic constexpr SoALayout Layout = { FieldCount, " << (cold.empty() ? "0" : "(uint32_t)sizeof(Cold)") << ", Offsets, Sizes, ColdOffsets };\n\n";
+
+		//Proxy that reads like the component
+		os << "\t\tclass Ref {\n" <<
+			"\t\tpublic:\n" <<
+			"\t\t\tRef(SoA& storage, size_t index) noexcept\n" <<
+			"\t\t\t\t: mStorage(storage), mIndex(index) {}\n\n";
+		for (const Field* field : hot)
+			os << "\t\t\t[[nodiscard]] " << type(field) << "& " << field->Name << "(void) const noexcept { return mStorage." << field->Name << "[mIndex]; }\n";
+		for (const Field* field : cold)
+			os << "\t\t\t[[nodiscard]] " << type(field) << "& " << field->Name << "(void) const noexcept { return mStorage.Colds[mIndex]." << field->Name << "; }\n";
+		os << "\n\t\tprivate:\n" <<
+			"\t\t\tSoA& mStorage;\n" <<
+			"\t\t\tsize_t mIndex;\n" <<
+			"\t\t};\n\n";
+
+		os << "\t\t[[nodiscard]] size_t Size(void) const noexcept { return " << (hot.empty() ? "Colds" : hot.front()->Name) << ".Size(); }\n" <<
+			"\t\t[[nodiscard]] Ref operator[](size_t index) noexcept { return Ref(*this, index); }\n\n" <<
+			"\t\tvoid Reserve(size_t capacity)\n\t\t{\n";
+		for (const Field* field : hot)
+			os << "\t\t\t" << field->Name << ".Reserve(capacity);\n";
+		if (!cold.empty())
+			os << "\t\t\tColds.Reserve(capacity);\n";
+		os << "\t\t}\n\n" <<
+			"\t\tvoid Push(const " << name << "& component)\n\t\t{\n";
+		for (const Field* field : hot)
+			os << "\t\t\t" << field->Name << ".Push(component." << field->Name << ");\n";
+		if (!cold.empty())
+		{
+			os << "\t\t\tColds.Push({ ";
+			for (size_t i = 0; i < cold.size(); i++)
+				os << (i ? ", " : "") << "component." << cold[i]->Name;
+			os << " });\n";
+		}
+		os << "\t\t}\n\n" <<
+			"\t\t//Moves the last component over the removed one\n" <<
+			"\t\tvoid SwapRemove(size_t index) noexcept\n\t\t{\n";
+		for (const Field* field : hot)
+			os << "\t\t\t" << field->Name << ".SwapRemove(index);\n";
+		if (!cold.empty())
+			os << "\t\t\tColds.SwapRemove(index);\n";
+		os << "\t\t}\n\n" <<
+			"\t\t[[nodiscard]] " << name << " Get(size_t index) const\n\t\t{\n" <<
+			"\t\t\t" << name << " component;\n";
+		for (const Field* field : hot)
+			os << "\t\t\tcomponent." << field->Name << " = " << field->Name << "[index];\n";
+		for (const Field* field : cold)
+			os << "\t\t\tcomponent." << field->Name << " = Colds[index]." << field->Name << ";\n";
+		os << "\t\t\treturn component;\n" <<
+			"\t\t}\n\n" <<
+			"\t\tvoid Set(size_t index, const " << name << "& component)\n\t\t{\n";
+		for (const Field* field : hot)
+			os << "\t\t\t" << field->Name << "[index] = component." << field->Name << ";\n";
+		for (const Field* field : cold)
+			os << "\t\t\tColds[index]." << field->Name << " = component." << field->Name << ";\n";
+		os << "\t\t}\n" <<
+			"\t};\n\n";
+	}
+	os << "}\n";
+
+	if (mOptions.Registry)
+		return;
+	os.rdbuf(Files.Append(mProjectDir / "Exports.cpp").rdbuf());
+	for (const Object* obj : columnar)
+		os << linkage(mOptions) << "const gtr::SoALayout* GetSoALayout" << exportname(*obj) << "(void) { return &gtr::SoA<" << obj->Name << ">::Layout; }\n";
+	if (!columnar.empty())
+		os << '\n';
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "reflect.h"
+#include "Options.h"
+
+#include <unordered_map>
+
+/**
+* @brief Name used for symbols of the given object on generated code
+* @details Editor's name with spaces replaced by underscores, or the C++ name if there isn't one
+*/
+[[nodiscard]] std::string exportname(const Object& obj) noexcept;
+
+/**
+* @brief Path used to include the given header from generated code
+* @details Relative to the src directory of the project, with forward slashes
+*/
+[[nodiscard]] std::string includepath(const std::string& header) noexcept;
+
+/**
+* @brief Objects of the given kind sorted by their id and then by their name
+* @details Anything that isn't a component or a system is considered a script (ReflectionType::Object)
+*/
+[[nodiscard]] std::vector<const Object*> gather(const std::unordered_map<std::string, Object>& objects, ReflectionType type) noexcept;
+
+/**
+* @brief Linkage for generated functions, internal when they are reached through the registry
+*/
+[[nodiscard]] const char* linkage(const Options& options) noexcept;
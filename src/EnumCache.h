@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+* @brief Binary layout of .gt/enums.cache
+* @details Every enumeration is stored on its own record, found through a directory sorted by the hash
+*	of its name. When enumerations change only their records are appended, followed by a new directory,
+*	and the header is updated last, so records of enumerations that didn't change are never rewritten.
+*	Like FlatModel.h it doesn't depend on anything else and can be mapped and used as it is.
+*/
+namespace gtr { namespace enumcache {
+
+	constexpr uint32_t Magic = 0x45525447;//"GTRE"
+	constexpr uint32_t FormatVersion = 1;
+
+	struct Header {
+		uint32_t Magic = enumcache::Magic;
+		uint32_t Version = FormatVersion;
+		uint32_t Count = 0;
+		uint32_t Padding = 0;
+		uint64_t Directory = 0;
+		uint64_t Size = 0;//Bytes in use, including records that are no longer reachable
+		uint64_t Dead = 0;//Bytes of records and directories that are no longer reachable
+	};
+
+	struct DirEntry {
+		uint64_t NameHash = 0;
+		uint64_t ContentHash = 0;
+		uint64_t Offset = 0;//Of the record
+		uint64_t Size = 0;//Of the record, including its names and values
+	};
+
+	/**
+	* @brief A single enumeration
+	* @details Followed by the name and the C++ name (both null terminated) padded to 8 bytes,
+	*	then by ValueCount values and finally by the names of the values
+	*/
+	struct Record {
+		uint64_t Size = 0;//Of the enumeration
+		uint32_t Type = 0;//FieldType
+		uint32_t ValueCount = 0;
+		uint32_t NameLength = 0;
+		uint32_t CppNameLength = 0;
+	};
+
+	struct Value {
+		uint64_t Value = 0;//Raw bits of either Value or Uvalue
+		uint32_t NameOffset = 0;//From the beginning of the record
+		uint32_t NameLength = 0;
+	};
+
+	static_assert(sizeof(Header) == 40, "Layout of gtr::enumcache::Header must not change");
+	static_assert(sizeof(DirEntry) == 32, "Layout of gtr::enumcache::DirEntry must not change");
+	static_assert(sizeof(Record) == 24, "Layout of gtr::enumcache::Record must not change");
+	static_assert(sizeof(Value) == 16, "Layout of gtr::enumcache::Value must not change");
+
+	/**
+	* @brief 64-bit FNV-1a, used for the names on the directory
+	*/
+	[[nodiscard]] constexpr uint64_t Hash(const char* str, size_t length, uint64_t hash = 14695981039346656037ull) noexcept
+	{
+		for (size_t i = 0; i < length; i++)
+			hash = (hash ^ (uint8_t)str[i]) * 1099511628211ull;
+		return hash;
+	}
+
+	[[nodiscard]] inline const DirEntry* GetDirectory(const void* base) noexcept
+	{
+		const auto* header = static_cast<const Header*>(base);
+		return reinterpret_cast<const DirEntry*>(static_cast<const uint8_t*>(base) + header->Directory);
+	}
+
+	[[nodiscard]] inline const Record* GetRecord(const void* base, const DirEntry& entry) noexcept
+	{
+		return reinterpret_cast<const Record*>(static_cast<const uint8_t*>(base) + entry.Offset);
+	}
+
+	[[nodiscard]] inline const char* GetName(const Record* record) noexcept { return reinterpret_cast<const char*>(record + 1); }
+	[[nodiscard]] inline const char* GetCppName(const Record* record) noexcept { return GetName(record) + record->NameLength + 1; }
+
+	[[nodiscard]] inline const Value* GetValues(const Record* record) noexcept
+	{
+		const size_t names = (record->NameLength + record->CppNameLength + 2 + 7) & ~(size_t)7;
+		return reinterpret_cast<const Value*>(reinterpret_cast<const uint8_t*>(record + 1) + names);
+	}
+
+	[[nodiscard]] inline const char* GetName(const Record* record, const Value& value) noexcept
+	{
+		return reinterpret_cast<const char*>(record) + value.NameOffset;
+	}
+
+	/**
+	* @brief Whether the record of an entry, its names and its values lie inside the first used bytes of the cache
+	*/
+	[[nodiscard]] inline bool IsValid(const void* base, uint64_t used, const DirEntry& entry) noexcept
+	{
+		if (entry.Offset < sizeof(Header) || entry.Offset % 8 != 0 || entry.Offset > used || entry.Size > used - entry.Offset || entry.Size < sizeof(Record))
+			return false;
+
+		const Record* record = GetRecord(base, entry);
+		const uint64_t names = ((uint64_t)record->NameLength + record->CppNameLength + 2 + 7) & ~(uint64_t)7;
+		if (sizeof(Record) + names + (uint64_t)record->ValueCount * sizeof(Value) > entry.Size)
+			return false;
+		if (GetName(record)[record->NameLength] != '\0' || GetCppName(record)[record->CppNameLength] != '\0')
+			return false;
+
+		const Value* values = GetValues(record);
+		for (uint32_t i = 0; i < record->ValueCount; i++)
+		{
+			if ((uint64_t)values[i].NameOffset + values[i].NameLength >= entry.Size || GetName(record, values[i])[values[i].NameLength] != '\0')
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	* @brief Header of a cache that can be read, nullptr when it was written by another version or it is damaged
+	* @details The directory and every record it points to are checked to lie inside the file, so the rest
+	*	of the functions can trust them
+	*/
+	[[nodiscard]] inline const Header* GetHeader(const void* base, size_t size) noexcept
+	{
+		const auto* header = static_cast<const Header*>(base);
+		if (size < sizeof(Header) || header->Magic != Magic || header->Version != FormatVersion || header->Size > size || header->Size < sizeof(Header))
+			return nullptr;
+		if (header->Directory < sizeof(Header) || header->Directory % 8 != 0 || header->Directory > header->Size ||
+			(uint64_t)header->Count * sizeof(DirEntry) > header->Size - header->Directory)
+			return nullptr;
+
+		const DirEntry* directory = GetDirectory(base);
+		for (uint32_t i = 0; i < header->Count; i++)
+		{
+			if (!IsValid(base, header->Size, directory[i]))
+				return nullptr;
+		}
+		return header;
+	}
+
+	/**
+	* @brief Finds the record of an enumeration by its name on the editor
+	*/
+	[[nodiscard]] inline const Record* Find(const void* base, const char* name) noexcept
+	{
+		const auto* header = static_cast<const Header*>(base);
+		const DirEntry* directory = GetDirectory(base);
+		const size_t length = strlen(name);
+		const uint64_t hash = Hash(name, length);
+
+		uint32_t first = 0, last = header->Count;
+		while (first < last)
+		{
+			const uint32_t middle = first + (last - first) / 2;
+			if (directory[middle].NameHash < hash)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+		for (; first < header->Count && directory[first].NameHash == hash; first++)
+		{
+			const Record* record = GetRecord(base, directory[first]);
+			if (record->NameLength == length && memcmp(GetName(record), name, length) == 0)
+				return record;
+		}
+		return nullptr;
+	}
+
+} }
@@ -0,0 +1,221 @@
+#include "EnumCacheWriter.h"
+#include "EnumCache.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+using namespace gtr;
+
+template<typename T>
+static void append(std::string& out, const T& value) noexcept { out.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+
+static void pad(std::string& out) noexcept { out.resize((out.size() + 7) & ~(size_t)7, '\0'); }
+
+[[nodiscard]] uint64_t ContentHash(const Enum& enm) noexcept
+{
+	//Strings are hashed with their terminator so their boundaries are part of the hash
+	uint64_t hash = enumcache::Hash(enm.Meta.Name.c_str(), enm.Meta.Name.size() + 1);
+	hash = enumcache::Hash(enm.Name.c_str(), enm.Name.size() + 1, hash);
+	const uint64_t header[] = { (uint64_t)enm.Type, (uint64_t)enm.Meta.Size, (uint64_t)enm.Values.size() };
+	hash = enumcache::Hash(reinterpret_cast<const char*>(header), sizeof(header), hash);
+	for (const auto& [name, value] : enm.Values)
+	{
+		hash = enumcache::Hash(name.c_str(), name.size() + 1, hash);
+		hash = enumcache::Hash(reinterpret_cast<const char*>(&value.Uvalue), sizeof(value.Uvalue), hash);
+	}
+	return hash;
+}
+
+/**
+* @brief Appends the record of an enumeration, out must be aligned to 8 bytes
+*/
+static void write_record(std::string& out, const Enum& enm) noexcept
+{
+	const size_t start = out.size();
+
+	enumcache::Record record;
+	record.Size = enm.Meta.Size;
+	record.Type = (uint32_t)enm.Type;
+	record.ValueCount = (uint32_t)enm.Values.size();
+	record.NameLength = (uint32_t)enm.Meta.Name.size();
+	record.CppNameLength = (uint32_t)enm.Name.size();
+	append(out, record);
+	out.append(enm.Meta.Name.c_str(), enm.Meta.Name.size() + 1);
+	out.append(enm.Name.c_str(), enm.Name.size() + 1);
+	pad(out);
+
+	uint32_t nameOffset = (uint32_t)(out.size() - start + enm.Values.size() * sizeof(enumcache::Value));
+	for (const auto& [name, value] : enm.Values)
+	{
+		enumcache::Value val;
+		val.Value = value.Uvalue;
+		val.NameOffset = nameOffset;
+		val.NameLength = (uint32_t)name.size();
+		append(out, val);
+		nameOffset += (uint32_t)name.size() + 1;
+	}
+	for (const auto& [name, value] : enm.Values)
+		out.append(name.c_str(), name.size() + 1);
+	pad(out);
+}
+
+/**
+* @brief Reads a cache written as YAML by an older version of gtreflect
+* @details It has no C++ names, so its enumerations are compared as they used to be instead of by hash
+*/
+static void input_legacy(const MappedFile& file, std::map<std::string, enumcache::DirEntry>& cached, std::map<std::string, Enum>& legacy) noexcept
+{
+	YAML::Node data;
+	try { data = YAML::Load(std::string(reinterpret_cast<const char*>(file.Data()), file.Size())); }
+	catch (YAML::ParserException e) { GTR_ASSERT(false, "Failed to load file: enums.cache\n\t%s\n", e.what()); }
+
+	for (const auto& node : data)
+	{
+		const auto name = node["Name"].as<std::string>();
+		size_t size = node["Size"].as<size_t>();
+		FieldType type = (FieldType)node["Type"].as<uint64_t>();
+		Enum obj(name, size, type);
+		YAML::Node values = node["Values"];
+		for (const auto& value : values)
+		{
+			const auto valname = value["Name"].as<std::string>();
+			EnumValue val;
+			if (obj.isUnsigned())
+				val.Uvalue = value["Value"].as<uint64_t>();
+			else
+				val.Value = value["Value"].as<int64_t>();
+			obj.Values.insert(std::make_pair(valname, val));
+		}
+		cached.emplace(name, enumcache::DirEntry());
+		legacy.emplace(name, obj);
+	}
+}
+
+void UpdateEnumCache(const std::filesystem::path& filepath, const std::unordered_map<std::string, Enum>& enums, ChangeManifest& changes, Artifacts& artifacts) noexcept
+{
+	//Only the directory and the names of the records are read
+	std::map<std::string, enumcache::DirEntry> cached;
+	std::map<std::string, Enum> legacy;
+	MappedFile file(filepath);
+	const enumcache::Header* header = file.Data() ? enumcache::GetHeader(file.Data(), file.Size()) : nullptr;
+	enumcache::Header old;
+	std::string kept;//Records & directories that stay where they are
+	if (header)
+	{
+		old = *header;
+		const enumcache::DirEntry* directory = enumcache::GetDirectory(file.Data());
+		for (uint32_t i = 0; i < old.Count; i++)
+			cached.emplace(enumcache::GetName(enumcache::GetRecord(file.Data(), directory[i])), directory[i]);
+		kept.assign(reinterpret_cast<const char*>(file.Data()) + sizeof(enumcache::Header), old.Size - sizeof(enumcache::Header));
+	}
+	else if (file.Size() >= sizeof(uint32_t) && memcmp(file.Data(), &enumcache::Magic, sizeof(uint32_t)) == 0)//Other version, truncated or corrupted
+		gtr::Log("Discarding enums.cache, it was written by another version of gtreflect or it is damaged\n");
+	else if (file.Data())
+		input_legacy(file, cached, legacy);
+	file.Close();
+
+	std::vector<const Enum*> sorted;
+	for (const auto& [name, enm] : enums)
+		sorted.push_back(&enm);
+	std::sort(sorted.begin(), sorted.end(), [](const Enum* lhs, const Enum* rhs) { return lhs->Meta.Name < rhs->Meta.Name; });
+
+	//Check if there is a difference
+	std::vector<enumcache::DirEntry> directory;
+	std::vector<std::pair<const Enum*, uint64_t>> written;
+	uint64_t dead = old.Dead + old.Count * sizeof(enumcache::DirEntry);
+	uint64_t live = 0;
+	for (const Enum* enm : sorted)
+	{
+		const auto& name = enm->Meta.Name;
+		const uint64_t hash = ContentHash(*enm);
+		const auto it = cached.find(name);
+		if (it == cached.end())
+		{
+			changes.AddedEnums.push_back(name);
+			written.push_back({ enm, hash });
+			continue;
+		}
+
+		const bool modified = legacy.empty() ? it->second.ContentHash != hash : legacy.at(name) != *enm;
+		if (modified)
+		{
+			changes.ModifiedEnums.push_back(name);
+			written.push_back({ enm, hash });
+			dead += it->second.Size;
+		}
+		else
+		{
+			directory.push_back(it->second);
+			live += it->second.Size;
+		}
+		cached.erase(it);
+	}
+	for (const auto& [name, entry] : cached)
+	{
+		changes.RemovedEnums.push_back(name);
+		dead += entry.Size;
+	}
+
+	if (header && written.empty() && cached.empty())
+		return;
+	gtr::Log("Writing enumarations\n");
+
+	//Records are written relative to where they will be placed
+	std::string records;
+	std::vector<enumcache::DirEntry> appended;
+	const auto write_records = [&records, &appended](const std::vector<std::pair<const Enum*, uint64_t>>& list)
+	{
+		for (const auto& [enm, hash] : list)
+		{
+			enumcache::DirEntry entry;
+			entry.NameHash = enumcache::Hash(enm->Meta.Name.c_str(), enm->Meta.Name.size());
+			entry.ContentHash = hash;
+			entry.Offset = records.size();
+			write_record(records, *enm);
+			entry.Size = records.size() - entry.Offset;
+			appended.push_back(entry);
+		}
+	};
+	write_records(written);
+
+	//Appending forever would leave the cache mostly unreachable
+	const bool rewrite = !header || dead > live + records.size();
+	if (rewrite)
+	{
+		records.clear();
+		appended.clear();
+		directory.clear();
+		written.clear();
+		for (const Enum* enm : sorted)
+			written.push_back({ enm, ContentHash(*enm) });
+		write_records(written);
+		dead = 0;
+	}
+
+	const uint64_t base = rewrite ? sizeof(enumcache::Header) : old.Size;
+	for (auto& entry : appended)
+	{
+		entry.Offset += base;
+		directory.push_back(entry);
+	}
+	std::sort(directory.begin(), directory.end(), [](const enumcache::DirEntry& lhs, const enumcache::DirEntry& rhs) { return lhs.NameHash < rhs.NameHash; });
+
+	enumcache::Header updated;
+	updated.Count = (uint32_t)directory.size();
+	updated.Directory = base + records.size();
+	updated.Size = updated.Directory + directory.size() * sizeof(enumcache::DirEntry);
+	updated.Dead = dead;
+
+	std::string tail = records;
+	for (const auto& entry : directory)
+		append(tail, entry);
+
+	//The Engine maps the cache, so it is never modified in place: the new one is renamed over it
+	auto& os = artifacts.Write(filepath, true);
+	os.write(reinterpret_cast<const char*>(&updated), sizeof(updated));
+	if (!rewrite)
+		os << kept;
+	os << tail;
+}
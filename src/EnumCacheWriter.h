@@ -0,0 +1,24 @@
+#pragma once
+
+#include "reflect.h"
+#include "Artifacts.h"
+#include "Manifest.h"
+
+#include <filesystem>
+#include <unordered_map>
+
+/**
+* @brief Hash of everything the Engine cares about on an enumeration
+* @details Names, type, size and every value, so two enums with the same hash are equal
+*/
+[[nodiscard]] uint64_t ContentHash(const Enum& enm) noexcept;
+
+/**
+* @brief Compares the enumerations against .gt/enums.cache and writes only what changed
+* @details The cache is mapped and only its directory is read, enumerations are compared by their hashes.
+*	Changed enumerations are appended, unless unreachable records would take more space than the
+*	reachable ones, in which case the whole cache is rewritten. Either way the new cache is written
+*	as a whole and renamed over the old one, so the Engine never maps half of it. Caches written as
+*	YAML by older versions are read once and replaced, binary caches that can't be read are discarded.
+*/
+void UpdateEnumCache(const std::filesystem::path& filepath, const std::unordered_map<std::string, Enum>& enums, ChangeManifest& changes, Artifacts& artifacts) noexcept;
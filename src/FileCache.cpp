@@ -0,0 +1,148 @@
+#include "FileCache.h"
+
+#pragma warning(push)
+#pragma warning(disable: 4267 4244)
+#include <llvm/Support/Path.h>
+#pragma warning(pop)
+
+/**
+* @brief File handed out by the cache, its buffer points to the cached contents
+*/
+class CachedFile : public llvm::vfs::File {
+public:
+	CachedFile(llvm::vfs::Status status, llvm::MemoryBufferRef buffer) noexcept
+		: mStatus(std::move(status)), mBuffer(buffer) {}
+
+	llvm::ErrorOr<llvm::vfs::Status> status(void) override { return mStatus; }
+	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> getBuffer(const llvm::Twine& /*name*/, int64_t /*fileSize*/, bool requiresNullTerminator, bool /*isVolatile*/) override
+	{
+		return llvm::MemoryBuffer::getMemBuffer(mBuffer, requiresNullTerminator);
+	}
+	std::error_code close(void) override { return {}; }
+
+private:
+	llvm::vfs::Status mStatus;
+	llvm::MemoryBufferRef mBuffer;
+};
+
+/**
+* @brief View of the cache with its own working directory
+* @details Paths are made absolute before they reach the cache, names of the results are the ones
+*	that were asked for, the same as the real file system does.
+*/
+class CachedFileSystem : public llvm::vfs::FileSystem {
+public:
+	CachedFileSystem(FileCache& cache, const std::string& dir) noexcept
+		: mCache(cache), mWorkingDir(dir) {}
+
+	llvm::ErrorOr<llvm::vfs::Status> status(const llvm::Twine& path) override
+	{
+		const auto absolute = Absolute(path);
+		auto status = mCache.Status(absolute);
+		if (!status)
+			return status;
+		return llvm::vfs::Status::copyWithNewName(*status, path.str());
+	}
+
+	llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> openFileForRead(const llvm::Twine& path) override
+	{
+		const auto absolute = Absolute(path);
+		auto status = mCache.Status(absolute);
+		if (!status)
+			return status.getError();
+		if (status->isDirectory())
+			return std::make_error_code(std::errc::is_a_directory);
+		auto buffer = mCache.Buffer(absolute);
+		if (!buffer)
+			return buffer.getError();
+		return std::make_unique<CachedFile>(llvm::vfs::Status::copyWithNewName(*status, path.str()), *buffer);
+	}
+
+	//Directories are only listed for module maps & frameworks, so they go to disk
+	llvm::vfs::directory_iterator dir_begin(const llvm::Twine& dir, std::error_code& error) override
+	{
+		return mCache.mDisk->dir_begin(Absolute(dir), error);
+	}
+
+	std::error_code getRealPath(const llvm::Twine& path, llvm::SmallVectorImpl<char>& output) const override
+	{
+		return mCache.mDisk->getRealPath(Absolute(path), output);
+	}
+
+	llvm::ErrorOr<std::string> getCurrentWorkingDirectory(void) const override { return mWorkingDir; }
+	std::error_code setCurrentWorkingDirectory(const llvm::Twine& path) override
+	{
+		const auto absolute = Absolute(path);
+		auto status = mCache.Status(absolute);
+		if (!status)
+			return status.getError();
+		if (!status->isDirectory())
+			return std::make_error_code(std::errc::not_a_directory);
+		mWorkingDir = absolute;
+		return {};
+	}
+
+private:
+	[[nodiscard]] std::string Absolute(const llvm::Twine& path) const noexcept
+	{
+		llvm::SmallString<256> absolute;
+		path.toVector(absolute);
+		if (!llvm::sys::path::is_absolute(absolute))
+		{
+			llvm::SmallString<256> relative = absolute;
+			absolute = mWorkingDir;
+			llvm::sys::path::append(absolute, relative);
+		}
+		llvm::sys::path::remove_dots(absolute, true);
+		return std::string(absolute);
+	}
+
+	FileCache& mCache;
+	std::string mWorkingDir;
+};
+
+FileCache::FileCache(void) noexcept
+	: mDisk(llvm::vfs::createPhysicalFileSystem().release())
+{
+}
+
+[[nodiscard]] llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> FileCache::View(const std::string& dir) noexcept
+{
+	return llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem>(new CachedFileSystem(*this, dir));
+}
+
+[[nodiscard]] llvm::ErrorOr<llvm::vfs::Status> FileCache::Status(const std::string& path) noexcept
+{
+	{
+		std::lock_guard lock(mMutex);
+		const auto it = mStatuses.find(path);
+		if (it != mStatuses.end())
+		{
+			mHits++;
+			return it->second;
+		}
+	}
+
+	//Disk is hit outside of the lock, two threads may look up the same file but they'll find the same thing
+	mMisses++;
+	auto status = mDisk->status(path);
+	std::lock_guard lock(mMutex);
+	return mStatuses.emplace(path, std::move(status)).first->second;
+}
+
+[[nodiscard]] llvm::ErrorOr<llvm::MemoryBufferRef> FileCache::Buffer(const std::string& path) noexcept
+{
+	{
+		std::lock_guard lock(mMutex);
+		const auto it = mBuffers.find(path);
+		if (it != mBuffers.end())
+			return it->second->getMemBufferRef();
+	}
+
+	//Not volatile & null terminated, so large headers are mapped instead of copied
+	auto buffer = mDisk->getBufferForFile(path, -1, true, false);
+	if (!buffer)
+		return buffer.getError();
+	std::lock_guard lock(mMutex);
+	return mBuffers.emplace(path, std::move(*buffer)).first->second->getMemBufferRef();
+}
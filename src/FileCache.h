@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#pragma warning(push)
+#pragma warning(disable: 4267 4244)
+#include <llvm/ADT/IntrusiveRefCntPtr.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/VirtualFileSystem.h>
+#pragma warning(pop)
+
+/**
+* @brief Statuses and contents of the files that clang reads from disk, shared by parses that run at the same time
+* @details Headers are assumed not to change while the cache is alive. That holds for a batch of projects,
+*	since every project's own headers are inlined on its clangdump.hpp and what's left are the Engine's
+*	and third party headers, which are the same for all of them. Failed lookups are cached too, as most
+*	of the lookups for an include go through search paths that don't have it.
+*/
+class FileCache {
+public:
+	FileCache(void) noexcept;
+
+	/**
+	* @brief File system for the parses of a single project
+	* @details It has its own working directory, starting at dir, so projects never touch the process' one
+	*/
+	[[nodiscard]] llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> View(const std::string& dir) noexcept;
+
+	[[nodiscard]] size_t Hits(void) const noexcept { return mHits; }
+	[[nodiscard]] size_t Misses(void) const noexcept { return mMisses; }
+
+private:
+	friend class CachedFileSystem;
+
+	//Both take absolute paths
+	[[nodiscard]] llvm::ErrorOr<llvm::vfs::Status> Status(const std::string& path) noexcept;
+	[[nodiscard]] llvm::ErrorOr<llvm::MemoryBufferRef> Buffer(const std::string& path) noexcept;
+
+	llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> mDisk;
+	std::mutex mMutex;
+	std::unordered_map<std::string, llvm::ErrorOr<llvm::vfs::Status>> mStatuses;
+	std::unordered_map<std::string, std::unique_ptr<llvm::MemoryBuffer>> mBuffers;
+	std::atomic<size_t> mHits{ 0 };
+	std::atomic<size_t> mMisses{ 0 };
+};
@@ -1,885 +1,936 @@
-#include "Finders.h"
-#include "AnnotationParser.h"
-#include "uuid.h"
-
-#include <fstream>
-
-#pragma warning(push)
-#pragma warning(disable: 4267)
-#include <clang/AST/RecordLayout.h>
-#pragma warning(pop)
-
-static [[nodiscard]] Object input_object(const YAML::Node& data) noexcept;
-static void input_metadata(const YAML::Node& data, FieldMetadata& meta, FieldType type) noexcept;
-//static void output_object(std::ofstream& os, const Object& obj) noexcept;
-static void output_metadata(YAML::Emitter& out, const FieldMetadata& data, const YAML::Node& Default);
-
-void PostbuildFinder::WriteObjects(void) noexcept
-{
-	std::filesystem::path dir(mProjectDir / "Assets");
-
-	//Read current scripts
-	std::unordered_map<std::string, std::pair<uuid, Object>> Inputs;
-	for (const auto entry : std::filesystem::recursive_directory_iterator(dir))
-	{
-		const auto filename = entry.path();
-		const auto extension = filename.extension();
-		if (extension.compare(".gtscript") != 0 && extension.compare(".gtcomp") != 0 && extension.compare(".gtsystem") != 0)//Not script asset
-			continue;
-
-		uuid id;
-		uint16_t loaded = 0;
-		size_t size = 0;
-		
-		std::ifstream is(filename);
-		std::string line;
-		while (getline(is, line))
-		{
-			if (line[0] == '#')//Comment ingore
-				continue;
-			else if (line.empty() || line[0] == '\n' || line[0] == '\r')
-				break;
-			if (loaded == 0)
-			{
-				GTR_ASSERT(stoul(line) == 4, "Asset type isn't NativeScript");
-			}
-			else if (loaded == 1)
-				id = line;
-			else if (loaded == 2)
-				size = stoull(line);
-			loaded++;
-		}
-
-		char* buffer = new char[size + 1];
-		buffer[size] = 0;
-		is.read(buffer, size);
-		is.close();
-
-		//if (filename.stem() == "Player") { GTR_ASSERT(false, "Input: %s\n", buffer); }
-		YAML::Node data;
-		try { data = YAML::Load(buffer); }
-		catch (YAML::ParserException e) { GTR_ASSERT(false, "Failed to load file: %s\n\t%s\n", filename.string().c_str(), e.what()); }
-		delete[] buffer;
-
-		Object obj = input_object(data);
-		Inputs.insert({ std::filesystem::relative(filename, dir).string(), std::make_pair(id, obj) });
-	}
-
-	//Compares objects and find which should be written
-	std::unordered_map<std::string, std::pair<uuid, Object>> Outputs;
-	for (auto& [rname, obj] : Objects)
-	{
-		if (obj.Meta.Name.empty())
-			continue;
-
-		const auto& name = obj.Meta.Name;
-		boolean found = false;
-		for (const auto& [filepath, pair] : Inputs)
-		{
-			const auto& [id, old] = pair;
-			if (name.compare(old.Meta.Name) != 0)
-				continue;
-
-			if (old != obj)
-			{
-				obj.Version = old.Version + 1;
-				Outputs.insert({ filepath, std::make_pair(id, obj) });
-			}
-			Inputs.erase(filepath);
-			found = true;
-			break;
-		}
-		if (!found)
-		{
-			const auto extension = obj.Meta.Type == ReflectionType::Component ? ".gtcomp" : (obj.Meta.Type == ReflectionType::System ? ".gtsystem" : ".gtscript");
-			const auto outpath = "Scripts/" + name + extension;
-			Outputs.insert({ outpath, std::make_pair(uuid::Create(), obj) });
-		}
-	}
-
-	//Delete files that are no longer in use
-	for (const auto& [filepath, pair] : Inputs)
-		std::remove((mProjectDir / "Assets" / filepath).string().c_str());
-
-	//Write objects that changes
-	for (const auto& [filepath, pair] : Outputs)
-	{
-		const auto& [id, obj] = pair;
-
-		std::time_t result = std::time(nullptr);
-		std::ofstream os(dir / filepath, std::ios::binary);
-		os << "# Native-Script Asset for GreenTea Engine\n" <<
-			"# Auto generated by gtreflect.exe at " << std::asctime(std::localtime(&result)) <<
-			4 << '\n' <<
-			id << '\n';
-		
-		output_object(os, obj);
-		printf("Writing: %s\n", obj.Meta.Name.c_str());
-		os.close();
-	}
-}
-
-void PostbuildFinder::WriteEnums(void) const noexcept
-{
-	std::filesystem::path filepath = mProjectDir / ".gt/enums.cache";
-	bool shouldWrite = true;
-
-	if (std::filesystem::exists(filepath))
-	{
-		YAML::Node data;
-		try { data = YAML::LoadFile(filepath.string()); }
-		catch (YAML::ParserException e) { GTR_ASSERT(false, "Failed to load file: enums.cache\n\t%s\n", e.what()); }
-		
-		//Parse Enumaration from files
-		std::map<std::string, Enum> oldEnums;
-		for (const auto& node : data)
-		{
-			const auto name = node["Name"].as<std::string>();
-			size_t size = node["Size"].as<size_t>();
-			FieldType type = (FieldType)node["Type"].as<uint64_t>();
-			Enum obj(name, size, type);
-			YAML::Node values = node["Values"];
-			for (const auto& value : values)
-			{
-				const auto valname = value["Name"].as<std::string>();
-				EnumValue val;
-				if (obj.isUnsigned())
-					val.Uvalue = value["Value"].as<uint64_t>();
-				else
-					val.Value = value["Value"].as<int64_t>();
-				obj.Values.insert(std::make_pair(valname, val));
-			}
-			oldEnums.emplace(name, obj);
-		}
-
-		//Check if there is a difference
-		if (oldEnums.size() == Enums.size())
-		{
-			bool flagged = false;
-			for (const auto& [n, newenum] : Enums)
-			{
-				const auto name = newenum.Meta.Name;
-				if (oldEnums.find(name) == oldEnums.end())
-				{
-					flagged = true;
-					break;
-				}
-				if (oldEnums[name] != newenum)
-				{
-					flagged = true;
-					break;
-				}
-				oldEnums.erase(name);
-			}
-			if (oldEnums.size() == 0 && !flagged)
-				shouldWrite = false;
-		}
-	}
-
-	if (!shouldWrite)
-		return;
-	printf("Writing enumarations\n");
-
-	YAML::Emitter out;
-	std::time_t result = std::time(nullptr);
-	const auto comment = "Auto Generated file by gtreflect.exe at " + std::string(std::asctime(std::localtime(&result)));
-	out << YAML::Comment(comment);
-	out << YAML::BeginSeq;
-	for (const auto& [rname, enumobj] : Enums)
-	{
-		out << YAML::BeginMap;
-		out << YAML::Key << "Name" << YAML::Value << enumobj.Meta.Name;
-		out << YAML::Key << "Type" << YAML::Value << (uint64_t)enumobj.Type;
-		out << YAML::Key << "Size" << YAML::Value << enumobj.Meta.Size;
-		out << YAML::Key << "Values" << YAML::Value;
-		out << YAML::BeginSeq;
-		for (const auto& [valname, val] : enumobj.Values)
-			out << YAML::BeginMap <<
-			YAML::Key << "Name" << YAML::Value << valname <<
-			YAML::Key << "Value" << YAML::Value << (enumobj.isUnsigned() ? val.Uvalue : val.Value) <<
-			YAML::EndMap;
-		out << YAML::EndSeq;
-		out << YAML::EndMap;
-	}
-	out << YAML::EndSeq;
-
-	std::ofstream file(filepath);
-	file << out.c_str();
-	file.close();
-}
-
-void PostbuildFinder::FoundField(const clang::FieldDecl* fieldrec) noexcept
-{
-	Finder::FoundField(fieldrec);
-
-	//Parse annotation
-	const auto& annotation = get_annotation(fieldrec);
-	AnnotationParser parser(annotation);
-
-	const auto owner = fieldrec->getParent()->getNameAsString();
-	auto& field = Objects[owner].Fields.back();
-	const FieldType type = field.Meta.ValueType;
-
-	//Setup default value & metadata
-	llvm::APInt intval;
-	bool hasDefault = false;
-	if (fieldrec->hasInClassInitializer())
-	{
-		hasDefault = true;
-		const clang::Expr* expr = fieldrec->getInClassInitializer();
-
-		clang::Expr::EvalResult result;
-		if (expr->EvaluateAsInt(result, fieldrec->getASTContext()))
-			intval = result.Val.getInt();
-	}
-
-	switch (type)
-	{
-	case FieldType::Char:
-	case FieldType::Enum_Char:
-	case FieldType::Enum_Int16:
-	case FieldType::Enum_Int32:
-	case FieldType::Enum_Int64:
-	case FieldType::Int16:
-	case FieldType::Int32:
-	case FieldType::Int64:
-		if (parser.Has("min"))
-			field.Meta.MinInt = parser.GetAs<int64_t>("min");
-		if (parser.Has("max"))
-			field.Meta.MaxInt = parser.GetAs<int64_t>("max");
-		if (hasDefault)
-			field.Default["Default"] = intval.getSExtValue();
-		else
-			field.Default["Default"] = 0;
-		break;
-	case FieldType::Byte:
-	case FieldType::Enum_Byte:
-	case FieldType::Enum_Uint16:
-	case FieldType::Enum_Uint32:
-	case FieldType::Enum_Uint64:
-	case FieldType::Uint16:
-	case FieldType::Uint32:
-	case FieldType::Uint64:
-		if (parser.Has("min"))
-			field.Meta.MinUint = parser.GetAs<uint64_t>("min");
-		if (parser.Has("max"))
-			field.Meta.MaxUint = parser.GetAs<uint64_t>("max");
-		if (hasDefault)
-			field.Default["Default"] = intval.getZExtValue();
-		else
-			field.Default["Default"] = 0;
-		break;
-	case FieldType::Float32:
-	case FieldType::Float64:
-		if (parser.Has("min") && type == FieldType::Float32)
-			field.Meta.MinFloat = parser.GetAs<float>("min");
-		else if (parser.Has("min") && type == FieldType::Float64)
-			field.Meta.MinFloat = parser.GetAs<double>("min");
-		if (parser.Has("max") && type == FieldType::Float32)
-			field.Meta.MaxFloat = parser.GetAs<float>("max");
-		else if (parser.Has("max") && type == FieldType::Float64)
-			field.Meta.MaxFloat = parser.GetAs<double>("max");
-		if (hasDefault)
-		{
-			llvm::APFloat val(0.0);
-			if (fieldrec->getInClassInitializer()->EvaluateAsFloat(val, fieldrec->getASTContext()))
-				field.Default["Default"] = val.convertToDouble();
-		}
-		else
-			field.Default["Default"] = 0.0;
-		break;
-	case FieldType::Vec2:
-	case FieldType::Vec3:
-	case FieldType::Vec4:
-		if (parser.Has("min"))
-			field.Meta.MinFloat = parser.GetAs<float>("min");
-		if (parser.Has("max"))
-			field.Meta.MaxFloat = parser.GetAs<float>("max");
-		if (hasDefault)
-		{
-			const clang::Expr* expr = fieldrec->getInClassInitializer();
-
-			std::string buffer;
-			llvm::raw_string_ostream os(buffer);
-			expr->dump(os, fieldrec->getASTContext());
-
-			std::vector<float> vec;
-			size_t offset = 0;
-			size_t index = 0;
-			while ((index = buffer.find("-FloatingLiteral", index)) != std::string::npos)
-			{
-				size_t start = buffer.find("'float' ", index) + 8;
-				size_t end = buffer.find('\n', index);
-				const auto check = buffer.substr(start, end - start);
-				vec.push_back(std::stof(check));
-				offset++;
-				index = end;
-			}
-			if (vec.size() == 1)
-			{
-				float val = vec[0];
-				if (type == FieldType::Vec2) field.Default["Default"] = std::array<float, 2>{val, val};
-				else if (type == FieldType::Vec3) field.Default["Default"] = std::array<float, 3>{val, val, val};
-				else field.Default["Default"] = std::array<float, 4>{val, val, val, val};
-			}
-			else if (type == FieldType::Vec2 && vec.size() == 2)
-				field.Default["Default"] = std::array<float, 2>{vec[0], vec[1]};
-			else if (type == FieldType::Vec3 && vec.size() == 3)
-				field.Default["Default"] = std::array<float, 3>{vec[0], vec[1], vec[2]};
-			else if (vec.size() == 4)
-				field.Default["Default"] = std::array<float, 4>{vec[0], vec[1], vec[2], vec[3]};
-		}
-		else
-		{
-			if (type == FieldType::Vec2) field.Default["Default"] = std::array<float, 2>{0.0f, 0.0f};
-			else if (type == FieldType::Vec3) field.Default["Default"] = std::array<float, 3>{0.0f, 0.0f, 0.0f};
-			else field.Default["Default"] = std::array<float, 4>{1.0f, 1.0f, 1.0f, 1.0f};
-		}
-		break;
-	case FieldType::String:
-		if (parser.Has("length"))
-			field.Meta.Length = parser.GetAs<size_t>("length");
-		else
-			field.Meta.Length = 15;
-		if (hasDefault)
-		{
-			std::string buffer;
-			llvm::raw_string_ostream os(buffer);
-			fieldrec->getInClassInitializer()->dump(os, fieldrec->getASTContext());
-			const size_t lineoffset = buffer.find("-StringLiteral");
-			if (lineoffset != std::string::npos)
-			{
-				size_t start = buffer.find('"', lineoffset);
-				size_t end = buffer.find_last_of('"');
-				field.Default["Default"] = buffer.substr(start + 1, (end - start - 1));
-			}
-			else
-				field.Default["Default"] = "";
-		}
-		else
-			field.Default["Default"] = "";
-		break;
-	case FieldType::Bool:
-		if (hasDefault)
-		{
-			const clang::Expr* expr = fieldrec->getInClassInitializer();
-			bool value;
-			expr->EvaluateAsBooleanCondition(value, fieldrec->getASTContext());
-			field.Default["Default"] = value;
-		}
-		else
-			field.Default["Default"] = false;
-		break;
-	default:
-		break;
-	}
-}
-
-void PostbuildFinder::FoundRecord(const clang::CXXRecordDecl* record) noexcept
-{
-	Finder::FoundRecord(record);
-
-	const auto name = record->getDeclName().getAsString();
-	auto& obj = Objects[name];
-	
-	//Add Parents' field
-	for (const auto& baseclass : record->bases())
-	{
-		auto basename = baseclass.getType().getAsString();
-		basename = basename.substr(basename.find(' ') + 1);
-		const auto& fields = Objects[basename].Fields;
-		for (const auto& field : fields)
-			obj.Fields.push_back(field);
-	}
-}
-
-void PostbuildFinder::FoundEnum(const clang::EnumDecl* enumdecl) noexcept
-{
-	Finder::FoundEnum(enumdecl);
-
-	const auto name = enumdecl->getDeclName().getAsString();
-	auto& enumaration = Enums[name];
-	for (auto it = enumdecl->enumerator_begin(); it != enumdecl->enumerator_end(); ++it)
-	{
-		bool isUnsigned = it->getInitVal().isUnsigned();
-		enumaration.Values.insert({ it->getNameAsString(), isUnsigned ? it->getInitVal().getZExtValue() : it->getInitVal().getExtValue() });
-	}
-}
-
-void PrebuildFinder::FoundRecord(const clang::CXXRecordDecl* record) noexcept
-{
-	Finder::FoundRecord(record);
-
-	const Object& obj = Objects[record->getDeclName().getAsString()];
-	if (mHeaders.find(obj.Header) == mHeaders.end())
-	{
-		const auto& headerFile = obj.Header;
-		auto include = headerFile.substr(headerFile.find("src") + 4);
-		size_t index = include.find('\\');
-		while (index != std::string::npos)
-		{
-			include.replace(index, 1, "/");
-			index = include.find('\\', index + 1);
-		}
-		std::ofstream os(mProjectDir / "Exports.h", std::ios_base::app);
-		os << "#include <" << include << ">\n";
-		os.close();
-		mHeaders.insert({ headerFile, true });
-	}
-
-	const auto& name = obj.Name;
-	auto metaname = obj.Meta.Name;
-	size_t index = metaname.find(' ');
-	while (index != std::string::npos)
-	{
-		metaname.replace(index, 1, "_");
-		index = metaname.find(' ', index + 1);
-	}
-
-	std::ofstream os(mProjectDir / "Exports.cpp", std::ios_base::app);
-	if (obj.Meta.Type == ReflectionType::Component)
-	{
-		const std::string writename = !metaname.empty() ? metaname : name;
-		os << "\tGAME_API void* Create" << writename <<
-			"(Entity entity) " << " { return &entity.AddComponent<" << name << ">(); }\n";
-		os << "\tGAME_API void* Get" << writename <<
-			"(Entity entity) " << " { return &entity.GetComponent<" << name << ">(); }\n";
-		os << "\tGAME_API bool Has" << writename << "(Entity entity) " << "{ return entity.HasComponent<" << name << ">(); }\n";
-		os << "\tGAME_API void Remove" << writename << "(Entity entity) " << "{ entity.RemoveComponent<" << name << ">(); }\n\n";
-	}
-	else
-	{
-		os << "\tGAME_API " << (obj.Meta.Type == ReflectionType::System ? "System" : "ScriptableEntity") << "* Create" << (!metaname.empty() ? metaname : name) <<
-			"(void) { return new " << name << "(); }\n\n";
-	}
-	os.close();
-}
-
-PrebuildFinder::PrebuildFinder(const char* filepath) noexcept
-	: mProjectDir(filepath)
-{
-	auto test = mProjectDir.string();
-	std::string prjname;
-	if (test[test.size() - 1] == '\\' || test[test.size() - 1] == '/')
-		prjname = test.substr(test.find_last_of("/\\", test.size() - 2) + 1);
-	else
-		prjname = test.substr(test.find_last_of("/\\") + 1);
-	mProjectDir = (test + prjname);
-	std::time_t result = std::time(nullptr);
-	std::ofstream os(mProjectDir / "Exports.h");
-	os << "// Auto generated by gtreflect.exe at " << std::asctime(std::localtime(&result)) <<
-		"#pragma once\n\n";
-	os.close();
-
-	os.open(mProjectDir / "Exports.cpp");
-	os << "// Auto generated by gtreflect.exe at " << std::asctime(std::localtime(&result));
-	os << "#include \"Exports.h\"\n\n";
-	os << "extern \"C\" {\n\n";
-	os.close();
-}
-
-void PrebuildFinder::onEndOfTranslationUnit(void) noexcept
-{
-	std::ofstream os(mProjectDir / "Exports.cpp", std::ios_base::app);
-	os << '}';
-	os.close();
-}
-
-void Finder::FoundRecord(const clang::CXXRecordDecl* record) noexcept
-{
-	//Parse annotation
-	const auto& annotation = get_annotation(record);
-	AnnotationParser parser(annotation);
-	const auto& header = parser.GetHeader();
-
-	//Check and set Reflection Type
-	ReflectionType type = ReflectionType::Unknown;
-	if (header.compare("component") == 0)
-		type = ReflectionType::Component;
-	else if (header.compare("system") == 0)
-		type = ReflectionType::System;
-	else if (header.compare("class") == 0)
-		type = ReflectionType::Object;
-	else { GTR_ASSERT(false, "Reflection type for records should be component, system or class but '%s' was given.\n", header.c_str()); }
-
-	//Retrieve name & size
-	const auto name = record->getDeclName().getAsString();
-	const size_t size = record->getASTContext().getTypeInfo(record->getTypeForDecl()).Width / 8;
-
-	//Create object
-	Object obj = { name, size, type };
-	obj.Header = parser.Get("header");
-	if (parser.Has("name"))
-		obj.Meta.Name = parser.Get("name");
-	Objects.insert({ name, obj });
-
-	//Build offsets for every field
-	//sOffsets.clear();
-	//const auto* ptr = &record->getASTContext().getASTRecordLayout(record);
-	//if (ptr->getFieldCount())
-	//{
-	//	size_t offset = ptr->getFieldOffset(0) / 8;
-	//	const auto range = record->fields();
-	//	for (auto fieldptr : range)
-	//	{
-	//		sOffsets.push_back(offset);
-	//		offset += record->getASTContext().getTypeInfo(fieldptr->getType().getTypePtr()).Width / 8;
-	//	}
-	//}
-}
-
-void Finder::FoundField(const clang::FieldDecl* field) noexcept
-{
-	//Parse annotation
-	const auto& annotation = get_annotation(field);
-	AnnotationParser parser(annotation);
-	const auto& header = parser.GetHeader();
-
-	//Check Reflection Type & Field Type
-	if (header.compare("property") != 0) { GTR_ASSERT(false, "Reflection Type for field should be property.\n"); }
-	const FieldType type = gettype(field->getType().getCanonicalType());
-	if (type == FieldType::Unknown) { GTR_ASSERT(false, "Type: %s cannot be reflected as field.\n", field->getType().getAsString().c_str()); }
-
-	//Retrieve Name & size
-	const auto name = field->getDeclName().getAsString();
-	const size_t size = field->getASTContext().getTypeInfo(field->getType().getTypePtr()).Width / 8;
-	const size_t offset = field->getASTContext().getFieldOffset(field) / 8;//sOffsets[field->getFieldIndex()];
-
-	//Create field
-	const auto owner = field->getParent()->getNameAsString();
-	auto& fieldobj = Objects[owner].Fields.emplace_back(name, size, offset, type);
-	const auto enum_t = field->getType().getCanonicalType().getAsString();
-	switch (fieldobj.Meta.ValueType)
-	{
-	case FieldType::Enum_Char:
-	case FieldType::Enum_Byte:
-	case FieldType::Enum_Int16:
-	case FieldType::Enum_Int32:
-	case FieldType::Enum_Int64:
-	case FieldType::Enum_Uint16:
-	case FieldType::Enum_Uint32:
-	case FieldType::Enum_Uint64:
-		fieldobj.TypeName = enum_t.substr(5);
-		break;
-	case FieldType::String:
-		fieldobj.TypeName = "string";
-		break;
-	case FieldType::Bool:
-		fieldobj.TypeName = "bool";
-		break;
-	case FieldType::Char:
-		fieldobj.TypeName = "char";
-		break;
-	case FieldType::Byte:
-		fieldobj.TypeName = "byte";
-		break;
-	case FieldType::Int16:
-		fieldobj.TypeName = "int16";
-		break;
-	case FieldType::Int32:
-		fieldobj.TypeName = "int32";
-		break;
-	case FieldType::Int64:
-		fieldobj.TypeName = "int64";
-		break;
-	case FieldType::Uint16:
-		fieldobj.TypeName = "uint16";
-		break;
-	case FieldType::Uint32:
-		fieldobj.TypeName = "uint32";
-		break;
-	case FieldType::Uint64:
-		fieldobj.TypeName = "uint64";
-		break;
-	case FieldType::Float32:
-		fieldobj.TypeName = "float32";
-		break;
-	case FieldType::Float64:
-		fieldobj.TypeName = "float64";
-		break;
-	case FieldType::Vec2:
-		fieldobj.TypeName = "vec2";
-		break;
-	case FieldType::Vec3:
-		fieldobj.TypeName = "vec3";
-		break;
-	case FieldType::Vec4:
-		fieldobj.TypeName = "vec4";
-		break;
-	case FieldType::Asset:
-		fieldobj.TypeName = "asset";
-		break;
-	case FieldType::Entity:
-		fieldobj.TypeName = "entity";
-		break;
-	}
-
-	if (parser.Has("name"))
-		fieldobj.Meta.Name = parser.Get("name");
-}
-
-void Finder::FoundEnum(const clang::EnumDecl* enumdecl) noexcept 
-{
-	//Parse annotation
-	const auto& annotation = get_annotation(enumdecl);
-	AnnotationParser parser(annotation);
-	const auto& header = parser.GetHeader();
-
-	//Check Reflection Type & Field Type
-	if (header.compare("enum") != 0) { GTR_ASSERT(false, "Reflection Type for enum should be enum.\n"); }
-	const auto name = enumdecl->getDeclName().getAsString();
-	const size_t size = enumdecl->getASTContext().getTypeInfo(enumdecl->getIntegerType()).Width / 8;
-	FieldType type = enumtype(enumdecl);
-	Enum enumaration{ name, size, type };
-	if (parser.Has("name"))
-		enumaration.Meta.Name = parser.Get("name");
-	Enums.insert({ name, enumaration });
-}
-
-void Finder::run(const clang::ast_matchers::MatchFinder::MatchResult& result) noexcept
-{
-	const auto* enumdecl = result.Nodes.getNodeAs<clang::EnumDecl>("id");
-	if (enumdecl)
-		return FoundEnum(enumdecl);
-
-	const auto* record = result.Nodes.getNodeAs<clang::CXXRecordDecl>("id");
-	if (record)
-		return FoundRecord(record);
-
-	const auto* field = result.Nodes.getNodeAs<clang::FieldDecl>("id");
-	if (field)
-		return FoundField(field);
-}
-
-[[nodiscard]] std::string Finder::get_annotation(const clang::Decl* decl) noexcept
-{
-	std::string annotation = "";
-	llvm::raw_string_ostream os(annotation);
-	auto policy = clang::PrintingPolicy(clang::LangOptions());
-
-	decl->getAttr<clang::Attr>()->printPretty(os, policy);
-	return annotation.substr(0, annotation.size() - 4).substr(annotation.find('"') + 1);
-}
-
-[[nodiscard]] FieldType Finder::gettype(const clang::QualType& type) noexcept
-{
-	const std::string strtype = type.getAsString();
-	if (strtype.compare("bool") == 0 || strtype.compare("_Bool") == 0) return FieldType::Bool;
-	else if (strtype.compare("char") == 0) return FieldType::Char;
-	else if (strtype.compare("unsigned char") == 0) return FieldType::Byte;
-	else if (strtype.compare("short") == 0) return FieldType::Int16;
-	else if (strtype.compare("int") == 0) return FieldType::Int32;
-	else if (strtype.compare("long long") == 0) return FieldType::Int64;
-	else if (strtype.compare("unsigned short") == 0) return FieldType::Uint16;
-	else if (strtype.compare("unsigned int") == 0) return FieldType::Uint32;
-	else if (strtype.compare("unsigned long long") == 0) return FieldType::Uint64;
-	else if (strtype.compare("float") == 0) return FieldType::Float32;
-	else if (strtype.compare("double") == 0) return FieldType::Float64;
-	else if (strtype.compare("class dumm::String") == 0) return FieldType::String;
-	else if (strtype.compare("class std::shared_ptr<struct gte::Asset>") == 0) return FieldType::Asset;
-	else if (strtype.compare("struct gte::Asset") == 0) { GTR_ASSERT(false, "Asset should be reflected as a Reference. Use Ref<gte::Asset> instead."); }
-	else if (strtype.compare("class gte::Entity") == 0) return FieldType::Entity;
-	else if (strtype.substr(0, 31).compare("struct glm::vec<2, float, glm::") == 0) return FieldType::Vec2;
-	else if (strtype.substr(0, 31).compare("struct glm::vec<3, float, glm::") == 0) return FieldType::Vec3;
-	else if (strtype.substr(0, 31).compare("struct glm::vec<4, float, glm::") == 0) return FieldType::Vec4;
-	else if (strtype.substr(0, 4).compare("enum") == 0)
-	{
-		const auto enumname = strtype.substr(5);
-		GTR_ASSERT(Enums.find(enumname) != Enums.end(), "When using an enumeration in an exported property the enumaration should also be exported.\n\tCheck the decleration of '%s'.\n", enumname.c_str());
-		return Enums[enumname].Type;
-	}
-	else return FieldType::Unknown;
-}
-
-[[nodiscard]] FieldType Finder::enumtype(const clang::EnumDecl* decl) noexcept
-{
-	FieldType type = gettype(decl->getIntegerType().getCanonicalType());
-	//Transform to enum type
-	switch (type)
-	{
-	case FieldType::Enum_Char:
-	case FieldType::Char:
-		return FieldType::Enum_Char;
-	case FieldType::Enum_Byte:
-	case FieldType::Byte:
-		return FieldType::Enum_Byte;
-	case FieldType::Enum_Int16:
-	case FieldType::Int16:
-		return FieldType::Enum_Int16;
-	case FieldType::Enum_Int32:
-	case FieldType::Int32:
-		return FieldType::Enum_Int32;
-	case FieldType::Enum_Int64:
-	case FieldType::Int64:
-		return FieldType::Enum_Int64;
-	case FieldType::Enum_Uint16:
-	case FieldType::Uint16:
-		return FieldType::Enum_Uint16;
-	case FieldType::Enum_Uint32:
-	case FieldType::Uint32:
-		return FieldType::Enum_Uint32;
-	case FieldType::Enum_Uint64:
-	case FieldType::Uint64:
-		return FieldType::Enum_Uint64;
-		//Invalids
-	case FieldType::Unknown:
-	case FieldType::Bool:
-	case FieldType::Float32:
-	case FieldType::Float64:
-	case FieldType::Vec2:
-	case FieldType::Vec3:
-	case FieldType::Vec4:
-	case FieldType::String:
-		break;
-	}
-	return FieldType::Unknown;
-}
-
-[[nodiscard]] Object input_object(const YAML::Node& data) noexcept
-{
-	const auto name = data["Name"].as<std::string>();
-	ReflectionType type = (ReflectionType)data["Type"].as<uint64_t>();
-	Object obj(name, 1, type);
-	obj.Version = data["Version"].as<uint64_t>();
-	YAML::Node fields = data["Fields"];
-	for (const auto& fielddata : fields)
-	{
-		const auto fname = fielddata["Name"].as<std::string>();
-		size_t size = fielddata["Size"].as<size_t>();
-		size_t offset = fielddata["Offset"].as<size_t>();
-		FieldType ftype = (FieldType)fielddata["Type"].as<uint64_t>();
-		Field& field = obj.Fields.emplace_back(fname, size, offset, ftype);
-		input_metadata(fielddata, field.Meta, ftype);
-	}
-	return obj;
-}
-
-void input_metadata(const YAML::Node& data, FieldMetadata& meta, FieldType type) noexcept
-{
-	switch (type)
-	{
-	case FieldType::Char:
-	case FieldType::Int16:
-	case FieldType::Int32:
-	case FieldType::Int64:
-	case FieldType::Enum_Char:
-	case FieldType::Enum_Int16:
-	case FieldType::Enum_Int32:
-	case FieldType::Enum_Int64:
-		meta.MinInt = data["min"].as<int64_t>();
-		meta.MaxInt = data["max"].as<int64_t>();
-		break;
-	case FieldType::Byte:
-	case FieldType::Uint16:
-	case FieldType::Uint32:
-	case FieldType::Uint64:
-	case FieldType::Enum_Byte:
-	case FieldType::Enum_Uint16:
-	case FieldType::Enum_Uint32:
-	case FieldType::Enum_Uint64:
-		meta.MinUint = data["min"].as<uint64_t>();
-		meta.MaxUint = data["max"].as<uint64_t>();
-		break;
-	case FieldType::Float32:
-	case FieldType::Float64:
-	case FieldType::Vec2:
-	case FieldType::Vec3:
-	case FieldType::Vec4:
-		meta.MinFloat = data["min"].as<double>();
-		meta.MaxFloat = data["max"].as<double>();
-		break;
-	case FieldType::String:
-		meta.Length = data["length"].as<size_t>();
-		break;
-	default:
-		break;
-	}
-}
-
-void PostbuildFinder::output_object(std::ofstream& os, const Object& obj) noexcept
-{
-	YAML::Emitter out;
-	out << YAML::BeginMap;
-	out << YAML::Key << "Name" << YAML::Value << obj.Meta.Name;
-	out << YAML::Key << "Header" << YAML::Value << obj.Header;
-	out << YAML::Key << "Version" << YAML::Value << obj.Version;
-	out << YAML::Key << "Type" << YAML::Value << (uint64_t)obj.Meta.Type;
-	out << YAML::Key << "Fields" << YAML::Value << YAML::BeginSeq;
-	for (const auto& field : obj.Fields)
-	{
-		out << YAML::BeginMap;
-		out << YAML::Key << "Name" << YAML::Value << field.Meta.Name;
-		out << YAML::Key << "Type" << YAML::Value << (uint64_t)field.Meta.ValueType;
-		if (field.isEnum())
-		{
-			std::string Typename = Enums.at(field.TypeName).Meta.Name;
-			out << YAML::Key << "TypeName" << YAML::Value << Typename;
-		}
-		out << YAML::Key << "Offset" << YAML::Value << field.Offset;
-		out << YAML::Key << "Size" << YAML::Value << field.Meta.Size;
-		output_metadata(out, field.Meta, field.Default);
-		out << YAML::EndMap;
-	}
-	out << YAML::EndSeq;
-	out << YAML::EndMap;
-
-	std::string buff(out.c_str());
-	os << buff.size() << '\n' << '\n';
-	os << buff;
-	os.close();
-}
-
-void output_metadata(YAML::Emitter& out, const FieldMetadata& data, const YAML::Node& Default)
-{
-	switch (data.ValueType)
-	{
-	case FieldType::Char:
-	case FieldType::Int16:
-	case FieldType::Int32:
-	case FieldType::Int64:
-	case FieldType::Enum_Char:
-	case FieldType::Enum_Int16:
-	case FieldType::Enum_Int32:
-	case FieldType::Enum_Int64:
-		out << YAML::Key << "min" << YAML::Value << data.MinInt;
-		out << YAML::Key << "max" << YAML::Value << data.MaxInt;
-		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
-		break;
-	case FieldType::Byte:
-	case FieldType::Uint16:
-	case FieldType::Uint32:
-	case FieldType::Uint64:
-	case FieldType::Enum_Byte:
-	case FieldType::Enum_Uint16:
-	case FieldType::Enum_Uint32:
-	case FieldType::Enum_Uint64:
-		out << YAML::Key << "min" << YAML::Value << data.MinUint;
-		out << YAML::Key << "max" << YAML::Value << data.MaxUint;
-		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
-		break;
-	case FieldType::Float32:
-	case FieldType::Float64:
-	case FieldType::Vec2:
-	case FieldType::Vec3:
-	case FieldType::Vec4:
-		out << YAML::Key << "min" << YAML::Value << data.MinFloat;
-		out << YAML::Key << "max" << YAML::Value << data.MaxFloat;
-		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
-		break;
-	case FieldType::String:
-		out << YAML::Key << "length" << YAML::Value << data.Length;
-		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
-		break;
-	case FieldType::Bool:
-		out << YAML::Key << "Default" << YAML::Value << Default["Default"];
-		break;
-	default:
-		break;
-	}
-}
-
-void PostbuildFinder::onEndOfTranslationUnit(void) noexcept
-{
-	WriteEnums();
-	WriteObjects();
-}
\ No newline at end of file
+#include "Finders.h"
+#include "Access.h"
+#include "AnnotationParser.h"
+#include "Assets.h"
+#include "Codegen.h"
+#include "EnumCacheWriter.h"
+#include "Layout.h"
+#include "Migration.h"
+#include "SharedModel.h"
+#include "TypeIds.h"
+#include "uuid.h"
+
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+#pragma warning(push)
+#pragma warning(disable: 4267)
+#include <clang/AST/RecordLayout.h>
+#pragma warning(pop)
+
+[[nodiscard]] static StorageHints storage_hints(const AnnotationParser& parser, const std::string& name) noexcept;
+[[nodiscard]] static std::string base_name(const clang::CXXBaseSpecifier& base) noexcept;
+
+//Ids of new assets are named after the project & the asset's path on this namespace
+static const uuid sAssetNamespace("F4C47194-1638-4334-BEC0-7CC60FC8902E");
+
+void PostbuildFinder::WriteObjects(void) noexcept
+{
+	std::filesystem::path dir(mProjectDir / "Assets");
+
+	//Read current scripts
+	std::unordered_map<std::string, std::pair<uuid, Object>> Inputs;
+	std::unordered_set<std::string> Outdated;
+	std::unordered_set<uuid> Used;
+	for (const auto entry : std::filesystem::recursive_directory_iterator(dir))
+	{
+		const auto filename = entry.path();
+		const auto extension = filename.extension();
+		if (extension.compare(".gtscript") != 0 && extension.compare(".gtcomp") != 0 && extension.compare(".gtsystem") != 0)//Not script asset
+			continue;
+
+		uuid id;
+		uint16_t loaded = 0;
+		size_t size = 0;
+		
+		std::ifstream is(filename);
+		std::string line;
+		while (getline(is, line))
+		{
+			if (line[0] == '#')//Comment ingore
+				continue;
+			else if (line.empty() || line[0] == '\n' || line[0] == '\r')
+				break;
+			if (loaded == 0)
+			{
+				GTR_ASSERT(stoul(line) == 4, "Asset type isn't NativeScript");
+			}
+			else if (loaded == 1)
+				id = line;
+			else if (loaded == 2)
+				size = stoull(line);
+			loaded++;
+		}
+
+		std::string buffer(size, '\0');
+		is.read(buffer.data(), size);
+		is.close();
+
+		//if (filename.stem() == "Player") { GTR_ASSERT(false, "Input: %s\n", buffer); }
+		YAML::Node data;
+		try { data = YAML::Load(buffer); }
+		catch (YAML::ParserException e) { GTR_ASSERT(false, "Failed to load file: %s\n\t%s\n", filename.string().c_str(), e.what()); }
+
+		Object obj = ReadAsset(data);
+		const auto relative = std::filesystem::relative(filename, dir).string();
+		if (!data["Defaults"] || !data["References"])//Written by an older version
+			Outdated.insert(relative);
+		Inputs.insert({ relative, std::make_pair(id, obj) });
+		Used.insert(id);
+	}
+
+	//Compares objects and find which should be written
+	std::unordered_map<std::string, std::pair<uuid, Object>> Outputs;
+	std::unordered_map<std::string, Migration> Migrations;
+	std::vector<Object*> Created;
+	for (auto& [rname, obj] : Objects)
+	{
+		if (obj.Meta.Name.empty())
+			continue;
+
+		const auto& name = obj.Meta.Name;
+		bool found = false;
+		for (const auto& [filepath, pair] : Inputs)
+		{
+			const auto& [id, old] = pair;
+			if (name.compare(old.Meta.Name) != 0)
+				continue;
+
+			obj.Id = id.str();
+			obj.Version = old.Version;
+			if (mOptions.Targets.empty() && old.Fields == obj.Fields)//Configurations without -targets= keep the layouts of the ones with it
+				obj.Targets = old.Targets;
+			if (old != obj || Outdated.find(filepath) != Outdated.end())
+			{
+				obj.Version = old.Version + 1;
+				if (old != obj)
+				{
+					Migrations.insert({ filepath, Diff(old, obj) });
+					mChanges.Modified.push_back({ name, "", id.str(), filepath, old.Version, obj.Version });
+				}
+				Outputs.insert({ filepath, std::make_pair(id, obj) });
+			}
+			Inputs.erase(filepath);
+			found = true;
+			break;
+		}
+		if (!found)
+			Created.push_back(&obj);
+	}
+
+	for (Object* obj : Created)
+	{
+		const auto& name = obj->Meta.Name;
+		const auto extension = obj->Meta.Type == ReflectionType::Component ? ".gtcomp" : (obj->Meta.Type == ReflectionType::System ? ".gtsystem" : ".gtscript");
+		const auto outpath = "Scripts/" + name + extension;
+
+		//An asset that is no longer used with the same header & fields means that the object was renamed,
+		//objects without fields have nothing to tell them apart
+		auto renamed = Inputs.end();
+		for (auto it = Inputs.begin(); it != Inputs.end() && !obj->Fields.empty(); ++it)
+		{
+			const auto& old = it->second.second;
+			if (old.Meta.Type != obj->Meta.Type || old.Header.compare(obj->Header) != 0 || old.Fields.size() != obj->Fields.size())
+				continue;
+			if (std::equal(old.Fields.begin(), old.Fields.end(), obj->Fields.begin()))
+			{
+				renamed = it;
+				break;
+			}
+		}
+
+		if (renamed != Inputs.end())
+		{
+			const auto& [id, old] = renamed->second;
+			obj->Id = id.str();
+			if (mOptions.Targets.empty())
+				obj->Targets = old.Targets;
+			obj->Version = old.Version + 1;
+			mChanges.Renamed.push_back({ name, old.Meta.Name, id.str(), outpath, old.Version, obj->Version });
+			Outputs.insert({ outpath, std::make_pair(id, *obj) });
+			Files.Remove(mProjectDir / "Assets" / renamed->first);
+			Inputs.erase(renamed);
+			continue;
+		}
+
+		//An asset that is generated again gets the same id, unless a renamed asset took it already
+		const auto project = mProjectDir.has_filename() ? mProjectDir.filename() : mProjectDir.parent_path().filename();
+		uuid id = uuid::FromName(sAssetNamespace, project.generic_string() + "/" + outpath);
+		if (!Used.insert(id).second)
+		{
+			id = uuid::Create();
+			Used.insert(id);
+		}
+		obj->Id = id.str();
+		mChanges.Added.push_back({ name, "", id.str(), outpath, 0, obj->Version });
+		Outputs.insert({ outpath, std::make_pair(id, *obj) });
+	}
+
+	//Delete files that are no longer in use
+	for (const auto& [filepath, pair] : Inputs)
+	{
+		const auto& [id, old] = pair;
+		mChanges.Removed.push_back({ old.Meta.Name, "", id.str(), filepath, old.Version, old.Version });
+		Files.Remove(mProjectDir / "Assets" / filepath);
+	}
+
+	//Write objects that changes
+	for (const auto& [filepath, pair] : Outputs)
+	{
+		const auto& [id, obj] = pair;
+
+		auto& os = Files.Write(dir / filepath, true);
+		os << "# Native-Script Asset for GreenTea Engine\n" <<
+			"# Auto generated by gtreflect.exe at " << Timestamp() <<
+			4 << '\n' <<
+			id << '\n';
+		
+		const auto migration = Migrations.find(filepath);
+		WriteAsset(os, obj, Enums, migration != Migrations.end() ? &migration->second : nullptr);
+		gtr::Log("Writing: %s\n", obj.Meta.Name.c_str());
+	}
+}
+
+void PostbuildFinder::WriteEnums(void) noexcept
+{
+	UpdateEnumCache(mProjectDir / ".gt/enums.cache", Enums, mChanges, Files);
+}
+
+void PostbuildFinder::FoundField(const clang::FieldDecl* fieldrec) noexcept
+{
+	Finder::FoundField(fieldrec);
+	if (gtr::Failed())
+		return;
+
+	const auto owner = fieldrec->getParent()->getNameAsString();
+	auto& field = Objects[owner].Fields.back();
+	const FieldType type = field.Meta.ValueType;
+
+	//Setup default value & metadata
+	llvm::APInt intval;
+	bool hasDefault = false;
+	if (fieldrec->hasInClassInitializer())
+	{
+		hasDefault = true;
+		const clang::Expr* expr = fieldrec->getInClassInitializer();
+
+		clang::Expr::EvalResult result;
+		if (expr->EvaluateAsInt(result, fieldrec->getASTContext()))
+			intval = result.Val.getInt();
+	}
+
+	switch (type)
+	{
+	case FieldType::Char:
+	case FieldType::Enum_Char:
+	case FieldType::Enum_Int16:
+	case FieldType::Enum_Int32:
+	case FieldType::Enum_Int64:
+	case FieldType::Int16:
+	case FieldType::Int32:
+	case FieldType::Int64:
+		if (hasDefault)
+			field.Default["Default"] = intval.getSExtValue();
+		else
+			field.Default["Default"] = 0;
+		break;
+	case FieldType::Byte:
+	case FieldType::Enum_Byte:
+	case FieldType::Enum_Uint16:
+	case FieldType::Enum_Uint32:
+	case FieldType::Enum_Uint64:
+	case FieldType::Uint16:
+	case FieldType::Uint32:
+	case FieldType::Uint64:
+		if (hasDefault)
+			field.Default["Default"] = intval.getZExtValue();
+		else
+			field.Default["Default"] = 0;
+		break;
+	case FieldType::Float32:
+	case FieldType::Float64:
+		if (hasDefault)
+		{
+			llvm::APFloat val(0.0);
+			if (fieldrec->getInClassInitializer()->EvaluateAsFloat(val, fieldrec->getASTContext()))
+				field.Default["Default"] = val.convertToDouble();
+		}
+		else
+			field.Default["Default"] = 0.0;
+		break;
+	case FieldType::Vec2:
+	case FieldType::Vec3:
+	case FieldType::Vec4:
+		if (hasDefault)
+		{
+			const clang::Expr* expr = fieldrec->getInClassInitializer();
+
+			std::string buffer;
+			llvm::raw_string_ostream os(buffer);
+			expr->dump(os, fieldrec->getASTContext());
+
+			std::vector<float> vec;
+			size_t offset = 0;
+			size_t index = 0;
+			while ((index = buffer.find("-FloatingLiteral", index)) != std::string::npos)
+			{
+				size_t start = buffer.find("'float' ", index) + 8;
+				size_t end = buffer.find('\n', index);
+				const auto check = buffer.substr(start, end - start);
+				vec.push_back(std::stof(check));
+				offset++;
+				index = end;
+			}
+			if (vec.size() == 1)
+			{
+				float val = vec[0];
+				if (type == FieldType::Vec2) field.Default["Default"] = std::array<float, 2>{val, val};
+				else if (type == FieldType::Vec3) field.Default["Default"] = std::array<float, 3>{val, val, val};
+				else field.Default["Default"] = std::array<float, 4>{val, val, val, val};
+			}
+			else if (type == FieldType::Vec2 && vec.size() == 2)
+				field.Default["Default"] = std::array<float, 2>{vec[0], vec[1]};
+			else if (type == FieldType::Vec3 && vec.size() == 3)
+				field.Default["Default"] = std::array<float, 3>{vec[0], vec[1], vec[2]};
+			else if (vec.size() == 4)
+				field.Default["Default"] = std::array<float, 4>{vec[0], vec[1], vec[2], vec[3]};
+		}
+		else
+		{
+			if (type == FieldType::Vec2) field.Default["Default"] = std::array<float, 2>{0.0f, 0.0f};
+			else if (type == FieldType::Vec3) field.Default["Default"] = std::array<float, 3>{0.0f, 0.0f, 0.0f};
+			else field.Default["Default"] = std::array<float, 4>{1.0f, 1.0f, 1.0f, 1.0f};
+		}
+		break;
+	case FieldType::String:
+		if (hasDefault)
+		{
+			std::string buffer;
+			llvm::raw_string_ostream os(buffer);
+			fieldrec->getInClassInitializer()->dump(os, fieldrec->getASTContext());
+			const size_t lineoffset = buffer.find("-StringLiteral");
+			if (lineoffset != std::string::npos)
+			{
+				size_t start = buffer.find('"', lineoffset);
+				size_t end = buffer.find_last_of('"');
+				field.Default["Default"] = buffer.substr(start + 1, (end - start - 1));
+			}
+			else
+				field.Default["Default"] = "";
+		}
+		else
+			field.Default["Default"] = "";
+		break;
+	case FieldType::Bool:
+		if (hasDefault)
+		{
+			const clang::Expr* expr = fieldrec->getInClassInitializer();
+			bool value;
+			expr->EvaluateAsBooleanCondition(value, fieldrec->getASTContext());
+			field.Default["Default"] = value;
+		}
+		else
+			field.Default["Default"] = false;
+		break;
+	default:
+		break;
+	}
+}
+
+void PrebuildFinder::FoundRecord(const clang::CXXRecordDecl* record) noexcept
+{
+	Finder::FoundRecord(record);
+	if (gtr::Failed())
+		return;
+
+	const Object& obj = Objects[record->getDeclName().getAsString()];
+	if (mOptions.Lint && obj.Meta.Type != ReflectionType::Component)
+	{
+		auto issues = LintAllocations(record);
+		mIssues.insert(mIssues.end(), issues.begin(), issues.end());
+	}
+
+	if (mHeaders.find(obj.Header) == mHeaders.end())
+	{
+		Files.Append(mProjectDir / "Exports.h") << "#include <" << includepath(obj.Header) << ">\n";
+		mHeaders.insert({ obj.Header, true });
+	}
+
+	//Registry is written once every object has been found
+	if (mOptions.Registry)
+		return;
+
+	const auto& name = obj.Name;
+	const std::string writename = exportname(obj);
+	auto& os = Files.Append(mProjectDir / "Exports.cpp");
+	if (obj.Meta.Type == ReflectionType::Component)
+	{
+		os << "\tGAME_API void* Create" << writename <<
+			"(Entity entity) " << " { return &entity.AddComponent<" << name << ">(); }\n";
+		os << "\tGAME_API void* Get" << writename <<
+			"(Entity entity) " << " { return &entity.GetComponent<" << name << ">(); }\n";
+		os << "\tGAME_API bool Has" << writename << "(Entity entity) " << "{ return entity.HasComponent<" << name << ">(); }\n";
+		os << "\tGAME_API void Remove" << writename << "(Entity entity) " << "{ entity.RemoveComponent<" << name << ">(); }\n\n";
+	}
+	else
+	{
+		os << "\tGAME_API " << (obj.Meta.Type == ReflectionType::System ? "System" : "ScriptableEntity") << "* Create" << writename <<
+			"(void) { return new " << name << "(); }\n\n";
+	}
+}
+
+PrebuildFinder::PrebuildFinder(const char* filepath, const Options& options) noexcept
+	: mRootDir(filepath), mProjectDir(filepath), mOptions(options)
+{
+	auto test = mProjectDir.string();
+	std::string prjname;
+	if (test[test.size() - 1] == '\\' || test[test.size() - 1] == '/')
+		prjname = test.substr(test.find_last_of("/\\", test.size() - 2) + 1);
+	else
+		prjname = test.substr(test.find_last_of("/\\") + 1);
+	mProjectDir = (test + prjname);
+	const auto timestamp = Timestamp();
+	Files.Write(mProjectDir / "Exports.h") << "// Auto generated by gtreflect.exe at " << timestamp <<
+		"#pragma once\n\n";
+
+	auto& os = Files.Write(mProjectDir / "Exports.cpp");
+	os << "// Auto generated by gtreflect.exe at " << timestamp;
+	os << "#include \"Exports.h\"\n\n";
+	os << "extern \"C\" {\n\n";
+}
+
+void PrebuildFinder::onEndOfTranslationUnit(void) noexcept
+{
+	if (gtr::Failed())
+		return;
+
+	TypeIds ids(mRootDir / ".gt/typeids.cache");
+	ids.NextBuild();//Postbuild belongs to the same build
+	ids.Assign(Objects);
+	ids.Save(Files);
+
+	auto& os = Files.Append(mProjectDir / "Exports.cpp");
+	if (!mOptions.Registry)
+		os << "\tGAME_API uint32_t GetComponentCount(void) { return " << ids.Count() << "; }\n\n";
+	os << '}';
+
+	WriteTypeIds(ids.Count());
+	WriteSerializers();
+	WriteEnumTables();
+	WriteQuantizedSerializers();
+	WriteDirtyTracking();
+	WriteReferences();
+	WriteColumnar();
+	WriteSchedule();
+	if (mOptions.Registry)
+		WriteRegistry(ids.Count());
+	if (gtr::Failed())
+		return;
+
+	if (mOptions.LayoutReport)
+	{
+		std::ostringstream report;
+		WriteLayoutReport(report, Objects);
+		gtr::Log("%s", report.str().c_str());
+		Files.Write(mRootDir / ".gt/layout.report") << report.str();
+	}
+
+	if (mOptions.Lint)
+	{
+		std::ostringstream warnings;
+		WriteLintWarnings(warnings, mIssues);
+		gtr::Log("%s", warnings.str().c_str());
+		WriteLintJson(Files.Write(mRootDir / ".gt/lint.json"), mIssues);
+	}
+}
+
+void Finder::FoundRecord(const clang::CXXRecordDecl* record) noexcept
+{
+	//Parse annotation
+	const auto& annotation = get_annotation(record);
+	AnnotationParser parser(annotation);
+	const auto& header = parser.GetHeader();
+
+	//Check and set Reflection Type
+	ReflectionType type = ReflectionType::Unknown;
+	if (header.compare("component") == 0)
+		type = ReflectionType::Component;
+	else if (header.compare("system") == 0)
+		type = ReflectionType::System;
+	else if (header.compare("class") == 0)
+		type = ReflectionType::Object;
+	else { GTR_ASSERT(false, "Reflection type for records should be component, system or class but '%s' was given.\n", header.c_str()); }
+
+	//Retrieve name & size
+	const auto name = record->getDeclName().getAsString();
+	const size_t size = record->getASTContext().getTypeInfo(record->getTypeForDecl()).Width / 8;
+
+	//Create object
+	Object obj = { name, size, type };
+	obj.Header = parser.Get("header");
+	if (parser.Has("name"))
+		obj.Meta.Name = parser.Get("name");
+	obj.Storage = storage_hints(parser, name);
+	GTR_ASSERT(type == ReflectionType::Component || obj.Storage == StorageHints(), "Storage hints are only valid on components, check the annotation of '%s'.\n", name.c_str());
+	if (parser.Has("dirty"))
+	{
+		const auto dirty = parser.Get("dirty");
+		GTR_ASSERT(dirty.compare("true") == 0 || dirty.compare("false") == 0, "dirty of '%s' should be true or false but '%s' was given.\n", name.c_str(), dirty.c_str());
+		obj.TrackChanges = dirty.compare("true") == 0;
+		GTR_ASSERT(type == ReflectionType::Component || !obj.TrackChanges, "Dirty tracking is only valid on components, check the annotation of '%s'.\n", name.c_str());
+	}
+	if (parser.Has("soa"))
+	{
+		const auto soa = parser.Get("soa");
+		GTR_ASSERT(soa.compare("true") == 0 || soa.compare("false") == 0, "soa of '%s' should be true or false but '%s' was given.\n", name.c_str(), soa.c_str());
+		obj.Columnar = soa.compare("true") == 0;
+		GTR_ASSERT(type == ReflectionType::Component || !obj.Columnar, "Structure-of-arrays storage is only valid on components, check the annotation of '%s'.\n", name.c_str());
+	}
+	Objects.insert({ name, obj });
+
+	auto& object = Objects[name];
+
+	//Add Parents' field
+	for (const auto& baseclass : record->bases())
+	{
+		const auto it = Objects.find(base_name(baseclass));
+		if (it == Objects.end())
+			continue;
+		for (const auto& field : it->second.Fields)
+			object.Fields.push_back(field);
+	}
+
+	//Build layout of every member (reflected or not)
+	const auto& context = record->getASTContext();
+	const auto& layout = context.getASTRecordLayout(record);
+	if (layout.hasOwnVFPtr())
+		object.Layout.push_back({ "vptr", 0, (size_t)context.getTypeSize(context.VoidPtrTy) / 8, (size_t)context.getTypeAlign(context.VoidPtrTy) / 8, false });
+	for (const auto& baseclass : record->bases())
+	{
+		const auto* baserecord = baseclass.getType()->getAsCXXRecordDecl();
+		if (!baserecord || baseclass.isVirtual())
+			continue;
+		const auto& baselayout = context.getASTRecordLayout(baserecord);
+		const size_t offset = layout.getBaseClassOffset(baserecord).getQuantity();
+		object.Layout.push_back({ baserecord->getNameAsString(), offset, (size_t)baselayout.getNonVirtualSize().getQuantity(), (size_t)baselayout.getNonVirtualAlignment().getQuantity(), false });
+	}
+	for (const auto* fieldptr : record->fields())
+	{
+		const auto info = context.getTypeInfo(fieldptr->getType().getTypePtr());
+		const size_t offset = layout.getFieldOffset(fieldptr->getFieldIndex()) / 8;
+		object.Layout.push_back({ fieldptr->getNameAsString(), offset, (size_t)info.Width / 8, (size_t)info.Align / 8 });
+	}
+
+	const size_t natural = (size_t)layout.getAlignment().getQuantity();
+	GTR_ASSERT(object.Storage.Align == 0 || object.Storage.Align >= natural, "Alignment of '%s' must be at least %zu, which is its natural alignment.\n", name.c_str(), natural);
+
+	if (type == ReflectionType::System)
+		object.Access = AnalyzeAccess(record);
+}
+
+void Finder::FoundField(const clang::FieldDecl* field) noexcept
+{
+	//Parse annotation
+	const auto& annotation = get_annotation(field);
+	AnnotationParser parser(annotation);
+	const auto& header = parser.GetHeader();
+
+	//Check Reflection Type & Field Type
+	if (header.compare("property") != 0) { GTR_ASSERT(false, "Reflection Type for field should be property.\n"); }
+	const FieldType type = gettype(field->getType().getCanonicalType());
+	if (type == FieldType::Unknown) { GTR_ASSERT(false, "Type: %s cannot be reflected as field.\n", field->getType().getAsString().c_str()); }
+
+	//Retrieve Name & size
+	const auto name = field->getDeclName().getAsString();
+	const size_t size = field->getASTContext().getTypeInfo(field->getType().getTypePtr()).Width / 8;
+	const size_t offset = field->getASTContext().getFieldOffset(field) / 8;//sOffsets[field->getFieldIndex()];
+
+	//Create field
+	const auto owner = field->getParent()->getNameAsString();
+	auto& fieldobj = Objects[owner].Fields.emplace_back(name, size, offset, type);
+	const auto enum_t = field->getType().getCanonicalType().getAsString();
+	switch (fieldobj.Meta.ValueType)
+	{
+	case FieldType::Enum_Char:
+	case FieldType::Enum_Byte:
+	case FieldType::Enum_Int16:
+	case FieldType::Enum_Int32:
+	case FieldType::Enum_Int64:
+	case FieldType::Enum_Uint16:
+	case FieldType::Enum_Uint32:
+	case FieldType::Enum_Uint64:
+		fieldobj.TypeName = enum_t.substr(5);
+		break;
+	case FieldType::String:
+		fieldobj.TypeName = "string";
+		break;
+	case FieldType::Bool:
+		fieldobj.TypeName = "bool";
+		break;
+	case FieldType::Char:
+		fieldobj.TypeName = "char";
+		break;
+	case FieldType::Byte:
+		fieldobj.TypeName = "byte";
+		break;
+	case FieldType::Int16:
+		fieldobj.TypeName = "int16";
+		break;
+	case FieldType::Int32:
+		fieldobj.TypeName = "int32";
+		break;
+	case FieldType::Int64:
+		fieldobj.TypeName = "int64";
+		break;
+	case FieldType::Uint16:
+		fieldobj.TypeName = "uint16";
+		break;
+	case FieldType::Uint32:
+		fieldobj.TypeName = "uint32";
+		break;
+	case FieldType::Uint64:
+		fieldobj.TypeName = "uint64";
+		break;
+	case FieldType::Float32:
+		fieldobj.TypeName = "float32";
+		break;
+	case FieldType::Float64:
+		fieldobj.TypeName = "float64";
+		break;
+	case FieldType::Vec2:
+		fieldobj.TypeName = "vec2";
+		break;
+	case FieldType::Vec3:
+		fieldobj.TypeName = "vec3";
+		break;
+	case FieldType::Vec4:
+		fieldobj.TypeName = "vec4";
+		break;
+	case FieldType::Asset:
+		fieldobj.TypeName = "asset";
+		break;
+	case FieldType::Entity:
+		fieldobj.TypeName = "entity";
+		break;
+	}
+
+	if (parser.Has("name"))
+		fieldobj.Meta.Name = parser.Get("name");
+
+	//Bounds are used by the editor and by the quantized serializers (but not for enums, those use EnumTable),
+	//a missing bound of an integer is the limit of its type
+	const uint32_t bits = (uint32_t)std::min<size_t>(fieldobj.Meta.Size * 8, 64);
+	switch (type)
+	{
+	case FieldType::Char:
+	case FieldType::Enum_Char:
+	case FieldType::Enum_Int16:
+	case FieldType::Enum_Int32:
+	case FieldType::Enum_Int64:
+	case FieldType::Int16:
+	case FieldType::Int32:
+	case FieldType::Int64:
+		if (parser.Has("min") || parser.Has("max"))
+		{
+			const int64_t highest = (int64_t)(UINT64_MAX >> (65 - bits));
+			fieldobj.Meta.MinInt = parser.Has("min") ? parser.GetAs<int64_t>("min") : -highest - 1;
+			fieldobj.Meta.MaxInt = parser.Has("max") ? parser.GetAs<int64_t>("max") : highest;
+		}
+		break;
+	case FieldType::Byte:
+	case FieldType::Enum_Byte:
+	case FieldType::Enum_Uint16:
+	case FieldType::Enum_Uint32:
+	case FieldType::Enum_Uint64:
+	case FieldType::Uint16:
+	case FieldType::Uint32:
+	case FieldType::Uint64:
+		if (parser.Has("min") || parser.Has("max"))
+		{
+			fieldobj.Meta.MinUint = parser.Has("min") ? parser.GetAs<uint64_t>("min") : 0;
+			fieldobj.Meta.MaxUint = parser.Has("max") ? parser.GetAs<uint64_t>("max") : UINT64_MAX >> (64 - bits);
+		}
+		break;
+	case FieldType::Float32:
+	case FieldType::Vec2:
+	case FieldType::Vec3:
+	case FieldType::Vec4:
+		if (parser.Has("min"))
+			fieldobj.Meta.MinFloat = parser.GetAs<float>("min");
+		if (parser.Has("max"))
+			fieldobj.Meta.MaxFloat = parser.GetAs<float>("max");
+		break;
+	case FieldType::Float64:
+		if (parser.Has("min"))
+			fieldobj.Meta.MinFloat = parser.GetAs<double>("min");
+		if (parser.Has("max"))
+			fieldobj.Meta.MaxFloat = parser.GetAs<double>("max");
+		break;
+	case FieldType::String:
+		fieldobj.Meta.Length = parser.Has("length") ? parser.GetAs<size_t>("length") : 15;
+		break;
+	default:
+		break;
+	}
+	if (parser.Has("split"))
+	{
+		const auto split = parser.Get("split");
+		GTR_ASSERT(split.compare("hot") == 0 || split.compare("cold") == 0, "split of '%s::%s' should be hot or cold but '%s' was given.\n", owner.c_str(), name.c_str(), split.c_str());
+		fieldobj.Hot = split.compare("hot") == 0;
+	}
+	if (parser.Has("precision"))
+	{
+		const bool isFloat = type == FieldType::Float32 || type == FieldType::Float64 || type == FieldType::Vec2 || type == FieldType::Vec3 || type == FieldType::Vec4;
+		fieldobj.Precision = parser.GetAs<double>("precision");
+		GTR_ASSERT(isFloat && fieldobj.Precision > 0.0, "precision of '%s::%s' should be positive and it is only valid for floats & vecs.\n", owner.c_str(), name.c_str());
+	}
+}
+
+void Finder::FoundEnum(const clang::EnumDecl* enumdecl) noexcept 
+{
+	//Parse annotation
+	const auto& annotation = get_annotation(enumdecl);
+	AnnotationParser parser(annotation);
+	const auto& header = parser.GetHeader();
+
+	//Check Reflection Type & Field Type
+	if (header.compare("enum") != 0) { GTR_ASSERT(false, "Reflection Type for enum should be enum.\n"); }
+	const auto name = enumdecl->getDeclName().getAsString();
+	const size_t size = enumdecl->getASTContext().getTypeInfo(enumdecl->getIntegerType()).Width / 8;
+	FieldType type = enumtype(enumdecl);
+	Enum enumaration{ name, size, type };
+	if (parser.Has("name"))
+		enumaration.Meta.Name = parser.Get("name");
+
+	//clangdump.hpp marks where every header starts
+	const auto& sm = enumdecl->getASTContext().getSourceManager();
+	const auto location = sm.getPresumedLoc(sm.getExpansionLoc(enumdecl->getLocation()));
+	if (location.isValid())
+		enumaration.Header = location.getFilename();
+
+	//Values are needed on both steps, for the tables and for the cache
+	for (auto it = enumdecl->enumerator_begin(); it != enumdecl->enumerator_end(); ++it)
+	{
+		bool isUnsigned = it->getInitVal().isUnsigned();
+		enumaration.Values.insert({ it->getNameAsString(), isUnsigned ? it->getInitVal().getZExtValue() : it->getInitVal().getExtValue() });
+	}
+	Enums.insert({ name, enumaration });
+}
+
+void TargetFinder::run(const clang::ast_matchers::MatchFinder::MatchResult& result) noexcept
+{
+	if (gtr::Failed())
+		return;
+
+	const auto* record = result.Nodes.getNodeAs<clang::CXXRecordDecl>("id");
+	if (!record)
+		return;
+
+	const auto& context = record->getASTContext();
+	const auto info = context.getTypeInfo(record->getTypeForDecl());
+	TargetLayout layout;
+	layout.Size = info.Width / 8;
+	layout.Align = info.Align / 8;
+
+	//Fields of reflected bases come first, same as on Finder::FoundRecord
+	for (const auto& baseclass : record->bases())
+	{
+		const auto it = Layouts.find(base_name(baseclass));
+		if (it == Layouts.end())
+			continue;
+		layout.Offsets.insert(layout.Offsets.end(), it->second.Offsets.begin(), it->second.Offsets.end());
+		layout.Sizes.insert(layout.Sizes.end(), it->second.Sizes.begin(), it->second.Sizes.end());
+	}
+	for (const auto* field : record->fields())
+	{
+		if (!field->hasAttr<clang::AnnotateAttr>())
+			continue;
+		layout.Offsets.push_back(context.getFieldOffset(field) / 8);
+		layout.Sizes.push_back(context.getTypeInfo(field->getType().getTypePtr()).Width / 8);
+	}
+	Layouts[record->getDeclName().getAsString()] = layout;
+}
+
+void Finder::run(const clang::ast_matchers::MatchFinder::MatchResult& result) noexcept
+{
+	//A failed project only waits for clang to finish
+	if (gtr::Failed())
+		return;
+
+	const auto* enumdecl = result.Nodes.getNodeAs<clang::EnumDecl>("id");
+	if (enumdecl)
+		return FoundEnum(enumdecl);
+
+	const auto* record = result.Nodes.getNodeAs<clang::CXXRecordDecl>("id");
+	if (record)
+		return FoundRecord(record);
+
+	const auto* field = result.Nodes.getNodeAs<clang::FieldDecl>("id");
+	if (field)
+		return FoundField(field);
+}
+
+[[nodiscard]] std::string Finder::get_annotation(const clang::Decl* decl) noexcept
+{
+	std::string annotation = "";
+	llvm::raw_string_ostream os(annotation);
+	auto policy = clang::PrintingPolicy(clang::LangOptions());
+
+	decl->getAttr<clang::Attr>()->printPretty(os, policy);
+	return annotation.substr(0, annotation.size() - 4).substr(annotation.find('"') + 1);
+}
+
+[[nodiscard]] FieldType Finder::gettype(const clang::QualType& type) noexcept
+{
+	const std::string strtype = type.getAsString();
+	if (strtype.compare("bool") == 0 || strtype.compare("_Bool") == 0) return FieldType::Bool;
+	else if (strtype.compare("char") == 0) return FieldType::Char;
+	else if (strtype.compare("unsigned char") == 0) return FieldType::Byte;
+	else if (strtype.compare("short") == 0) return FieldType::Int16;
+	else if (strtype.compare("int") == 0) return FieldType::Int32;
+	else if (strtype.compare("long long") == 0) return FieldType::Int64;
+	else if (strtype.compare("unsigned short") == 0) return FieldType::Uint16;
+	else if (strtype.compare("unsigned int") == 0) return FieldType::Uint32;
+	else if (strtype.compare("unsigned long long") == 0) return FieldType::Uint64;
+	else if (strtype.compare("float") == 0) return FieldType::Float32;
+	else if (strtype.compare("double") == 0) return FieldType::Float64;
+	else if (strtype.compare("class dumm::String") == 0) return FieldType::String;
+	else if (strtype.compare("class std::shared_ptr<struct gte::Asset>") == 0) return FieldType::Asset;
+	else if (strtype.compare("struct gte::Asset") == 0) { GTR_ASSERT_OR(false, FieldType::Unknown, "Asset should be reflected as a Reference. Use Ref<gte::Asset> instead."); }
+	else if (strtype.compare("class gte::Entity") == 0) return FieldType::Entity;
+	else if (strtype.substr(0, 31).compare("struct glm::vec<2, float, glm::") == 0) return FieldType::Vec2;
+	else if (strtype.substr(0, 31).compare("struct glm::vec<3, float, glm::") == 0) return FieldType::Vec3;
+	else if (strtype.substr(0, 31).compare("struct glm::vec<4, float, glm::") == 0) return FieldType::Vec4;
+	else if (strtype.substr(0, 4).compare("enum") == 0)
+	{
+		const auto enumname = strtype.substr(5);
+		GTR_ASSERT_OR(Enums.find(enumname) != Enums.end(), FieldType::Unknown, "When using an enumeration in an exported property the enumaration should also be exported.\n\tCheck the decleration of '%s'.\n", enumname.c_str());
+		return Enums[enumname].Type;
+	}
+	else return FieldType::Unknown;
+}
+
+[[nodiscard]] FieldType Finder::enumtype(const clang::EnumDecl* decl) noexcept
+{
+	FieldType type = gettype(decl->getIntegerType().getCanonicalType());
+	//Transform to enum type
+	switch (type)
+	{
+	case FieldType::Enum_Char:
+	case FieldType::Char:
+		return FieldType::Enum_Char;
+	case FieldType::Enum_Byte:
+	case FieldType::Byte:
+		return FieldType::Enum_Byte;
+	case FieldType::Enum_Int16:
+	case FieldType::Int16:
+		return FieldType::Enum_Int16;
+	case FieldType::Enum_Int32:
+	case FieldType::Int32:
+		return FieldType::Enum_Int32;
+	case FieldType::Enum_Int64:
+	case FieldType::Int64:
+		return FieldType::Enum_Int64;
+	case FieldType::Enum_Uint16:
+	case FieldType::Uint16:
+		return FieldType::Enum_Uint16;
+	case FieldType::Enum_Uint32:
+	case FieldType::Uint32:
+		return FieldType::Enum_Uint32;
+	case FieldType::Enum_Uint64:
+	case FieldType::Uint64:
+		return FieldType::Enum_Uint64;
+		//Invalids
+	case FieldType::Unknown:
+	case FieldType::Bool:
+	case FieldType::Float32:
+	case FieldType::Float64:
+	case FieldType::Vec2:
+	case FieldType::Vec3:
+	case FieldType::Vec4:
+	case FieldType::String:
+		break;
+	}
+	return FieldType::Unknown;
+}
+
+[[nodiscard]] static uint64_t hint_value(const AnnotationParser& parser, const char* key, const std::string& name, uint64_t max) noexcept
+{
+	const auto value = parser.Get(key);
+	GTR_ASSERT_OR(value.find_first_not_of("0123456789") == std::string::npos, 0, "Storage hint '%s' of '%s' should be a positive integer but '%s' was given.\n", key, name.c_str(), value.c_str());
+	errno = 0;
+	const uint64_t result = std::strtoull(value.c_str(), nullptr, 10);
+	GTR_ASSERT_OR(errno == 0 && result > 0 && result <= max, 0, "Storage hint '%s' of '%s' should be between 1 and %llu but '%s' was given.\n", key, name.c_str(), (unsigned long long)max, value.c_str());
+	return result;
+}
+
+[[nodiscard]] StorageHints storage_hints(const AnnotationParser& parser, const std::string& name) noexcept
+{
+	StorageHints hints;
+	if (parser.Has("instances"))
+		hints.Instances = hint_value(parser, "instances", name, UINT64_MAX);
+	if (parser.Has("chunk"))
+		hints.Chunk = (uint32_t)hint_value(parser, "chunk", name, UINT32_MAX);
+	if (parser.Has("align"))
+	{
+		hints.Align = (uint32_t)hint_value(parser, "align", name, 4096);
+		GTR_ASSERT_OR((hints.Align & (hints.Align - 1)) == 0, hints, "Alignment of '%s' must be a power of two but %u was given.\n", name.c_str(), hints.Align);
+	}
+	if (parser.Has("storage"))
+	{
+		const auto kind = parser.Get("storage");
+		if (kind.compare("dense") == 0)
+			hints.Kind = StorageKind::Dense;
+		else if (kind.compare("sparse") == 0)
+			hints.Kind = StorageKind::Sparse;
+		else { GTR_ASSERT_OR(false, hints, "Storage of '%s' should be dense or sparse but '%s' was given.\n", name.c_str(), kind.c_str()); }
+	}
+	return hints;
+}
+
+void PostbuildFinder::onEndOfTranslationUnit(void) noexcept
+{
+	if (gtr::Failed())
+		return;
+
+	TypeIds ids(mProjectDir / ".gt/typeids.cache");
+	ids.Assign(Objects);
+	ids.Save(Files);
+
+	//Objects that aren't records (owners of stray fields) have no layout
+	for (const auto& [triple, layouts] : TargetLayouts)
+	{
+		for (auto& [name, obj] : Objects)
+		{
+			const auto it = layouts.find(name);
+			if (it == layouts.end())
+				continue;
+			GTR_ASSERT(it->second.Offsets.size() == obj.Fields.size(), "'%s' has %zu fields on %s but %zu on the host.\n", name.c_str(), it->second.Offsets.size(), triple.c_str(), obj.Fields.size());
+			obj.Targets[triple] = it->second;
+		}
+	}
+
+	WriteEnums();
+	WriteObjects();
+	if (gtr::Failed())//Nothing is published for a failed project
+		return;
+	mChanges.Write(Files.Write(mProjectDir / ".gt/changes.manifest"));
+
+	if (mOptions.Database || mOptions.Publish)
+	{
+		auto model = FlattenModel(Objects, Enums, 0);
+		if (mOptions.Database)
+			Files.Write(mProjectDir / ".gt/reflection.gtdb", true).write((const char*)model.data(), model.size());
+		if (mOptions.Publish)
+			Generation = PublishModel(SharedModelName(mProjectDir), mProjectDir / ".gt", model);
+	}
+}
+
+//Objects are found by the name of their declaration, the spelling of a base can be qualified or elaborated
+[[nodiscard]] std::string base_name(const clang::CXXBaseSpecifier& base) noexcept
+{
+	const auto* record = base.getType()->getAsCXXRecordDecl();
+	return record ? record->getDeclName().getAsString() : std::string();
+}
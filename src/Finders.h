@@ -1,60 +1,103 @@
-#pragma once
-
-#include "reflect.h"
-#include <filesystem>
-
-#pragma warning(push)
-#pragma warning(disable: 4146)
-#pragma warning(disable: 4244 4267 4291)
-#pragma warning(disable: 4624)
-#include <clang/ASTMatchers/ASTMatchFinder.h>
-#pragma warning(pop)
-
-class Finder : public clang::ast_matchers::MatchFinder::MatchCallback {
-public:
-	std::unordered_map<std::string, Object> Objects;
-	std::unordered_map<std::string, Enum> Enums;
-
-	void run(const clang::ast_matchers::MatchFinder::MatchResult& result) noexcept override;
-
-protected:
-
-	virtual void FoundRecord(const clang::CXXRecordDecl* record) noexcept;
-	virtual void FoundField(const clang::FieldDecl* field) noexcept;
-	virtual void FoundEnum(const clang::EnumDecl* enumdecl) noexcept;
-
-	[[nodiscard]] std::string get_annotation(const clang::Decl* decl) noexcept;
-	[[nodiscard]] FieldType enumtype(const clang::EnumDecl* decl) noexcept;
-	[[nodiscard]] FieldType gettype(const clang::QualType& type) noexcept;
-
-};
-
-class PrebuildFinder : public Finder {
-public:
-	PrebuildFinder(const char* filepath) noexcept;
-	void FoundRecord(const clang::CXXRecordDecl* record) noexcept override;
-	void onEndOfTranslationUnit(void) noexcept override;
-private:
-	std::filesystem::path mProjectDir;
-	std::unordered_map<std::string, bool> mHeaders;
-};
-
-class PostbuildFinder : public Finder {
-public:
-	PostbuildFinder(const char* filepath) noexcept
-		: mProjectDir(filepath) {}
-	void onEndOfTranslationUnit(void) noexcept override;
-	void FoundRecord(const clang::CXXRecordDecl* record) noexcept override;
-	void FoundField(const clang::FieldDecl* fieldrec) noexcept override;
-	void FoundEnum(const clang::EnumDecl* enumdecl) noexcept override;
-
-private:
-
-	void WriteEnums(void) const noexcept;
-	void WriteObjects(void) noexcept;
-
-	void output_object(std::ofstream& os, const Object& obj) noexcept;
-
-private:
-	std::filesystem::path mProjectDir;
-};
\ No newline at end of file
+#pragma once
+
+#include "reflect.h"
+#include "Artifacts.h"
+#include "Lint.h"
+#include "Manifest.h"
+#include "Migration.h"
+#include "Options.h"
+#include <filesystem>
+
+#pragma warning(push)
+#pragma warning(disable: 4146)
+#pragma warning(disable: 4244 4267 4291)
+#pragma warning(disable: 4624)
+#include <clang/ASTMatchers/ASTMatchFinder.h>
+#pragma warning(pop)
+
+class Finder : public clang::ast_matchers::MatchFinder::MatchCallback {
+public:
+	std::unordered_map<std::string, Object> Objects;
+	std::unordered_map<std::string, Enum> Enums;
+	Artifacts Files;
+
+	void run(const clang::ast_matchers::MatchFinder::MatchResult& result) noexcept override;
+
+protected:
+
+	virtual void FoundRecord(const clang::CXXRecordDecl* record) noexcept;
+	virtual void FoundField(const clang::FieldDecl* field) noexcept;
+	virtual void FoundEnum(const clang::EnumDecl* enumdecl) noexcept;
+
+	[[nodiscard]] std::string get_annotation(const clang::Decl* decl) noexcept;
+	[[nodiscard]] FieldType enumtype(const clang::EnumDecl* decl) noexcept;
+	[[nodiscard]] FieldType gettype(const clang::QualType& type) noexcept;
+
+};
+
+class PrebuildFinder : public Finder {
+public:
+	PrebuildFinder(const char* filepath, const Options& options) noexcept;
+	void FoundRecord(const clang::CXXRecordDecl* record) noexcept override;
+	void onEndOfTranslationUnit(void) noexcept override;
+
+private:
+
+	void WriteTypeIds(uint32_t count) noexcept;
+	void WriteSerializers(void) noexcept;
+	void WriteRegistry(uint32_t count) noexcept;
+	void WriteEnumTables(void) noexcept;
+	void WriteQuantizedSerializers(void) noexcept;
+	void WriteDirtyTracking(void) noexcept;
+	void WriteReferences(void) noexcept;
+	void WriteColumnar(void) noexcept;
+	void WriteSchedule(void) noexcept;
+
+private:
+	std::filesystem::path mRootDir;
+	std::filesystem::path mProjectDir;
+	Options mOptions;
+	std::unordered_map<std::string, bool> mHeaders;
+	std::vector<LintIssue> mIssues;
+};
+
+class PostbuildFinder : public Finder {
+public:
+	PostbuildFinder(const char* filepath, const Options& options) noexcept
+		: mProjectDir(filepath), mOptions(options) {}
+	void onEndOfTranslationUnit(void) noexcept override;
+	void FoundField(const clang::FieldDecl* fieldrec) noexcept override;
+
+	/**
+	* @brief Generation of the model published on shared memory, 0 if it wasn't published
+	*/
+	uint64_t Generation = 0;
+
+	/**
+	* @brief Layouts on the extra targets by triple and then by record, found by TargetFinder before this run
+	*/
+	std::map<std::string, std::unordered_map<std::string, TargetLayout>> TargetLayouts;
+
+	[[nodiscard]] const ChangeManifest& Changes(void) const noexcept { return mChanges; }
+
+private:
+
+	void WriteEnums(void) noexcept;
+	void WriteObjects(void) noexcept;
+
+private:
+	std::filesystem::path mProjectDir;
+	Options mOptions;
+	ChangeManifest mChanges;
+};
+
+/**
+* @brief Finds the layout of every reflected record when compiled for another target
+* @details Runs on its own parse with the target's triple, fields are in the same order as Finder adds them
+*/
+class TargetFinder : public clang::ast_matchers::MatchFinder::MatchCallback {
+public:
+	std::unordered_map<std::string, TargetLayout> Layouts;
+
+	void run(const clang::ast_matchers::MatchFinder::MatchResult& result) noexcept override;
+};
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+/**
+* @brief Flat, pointer-free layout of the reflection model
+* @details Everything is addressed by offsets from the beginning of the buffer, so it can be mapped
+*	by any process at any address and used without deserialization. Strings are stored null terminated
+*	on a single string table. This header doesn't depend on anything else, so the Engine can use it as it is.
+*	Objects and enums are sorted by their name on the editor, so they double as name indices.
+*/
+namespace gtr { namespace flat {
+
+	constexpr uint32_t Magic = 0x4D525447;//"GTRM"
+	constexpr uint32_t ControlMagic = 0x43525447;//"GTRC"
+	constexpr uint32_t FormatVersion = 3;
+
+	struct String {
+		uint32_t Offset = 0;//On the string table
+		uint32_t Length = 0;
+	};
+
+	struct Header {
+		uint32_t Magic = flat::Magic;
+		uint32_t Version = FormatVersion;
+		uint64_t Generation = 0;
+		uint64_t Size = 0;//Of the whole buffer
+		uint32_t ObjectCount = 0;
+		uint32_t FieldCount = 0;
+		uint32_t EnumCount = 0;
+		uint32_t ValueCount = 0;
+		uint32_t RangeCount = 0;
+		uint32_t FixupCount = 0;
+		uint64_t Objects = 0;
+		uint64_t Fields = 0;
+		uint64_t Enums = 0;
+		uint64_t Values = 0;
+		uint64_t Ranges = 0;
+		uint64_t Fixups = 0;
+		uint64_t Ids = 0;//Indices of objects sorted by their uuid
+		uint64_t Images = 0;//Default images of every object, one after the other
+		uint64_t ImagesSize = 0;
+		uint64_t Strings = 0;
+		uint64_t StringsSize = 0;
+	};
+
+	struct Object {
+		String Name;
+		String CppName;
+		String Header;
+		String Id;//uuid of the asset
+		uint64_t Size = 0;
+		uint64_t Version = 0;
+		uint32_t Type = 0;//ReflectionType
+		uint32_t TypeId = UINT32_MAX;
+		uint32_t FirstField = 0;
+		uint32_t FieldCount = 0;
+		uint32_t FirstRange = 0;
+		uint32_t RangeCount = 0;
+		uint32_t FirstFixup = 0;//Fixups are indices of fields relative to FirstField
+		uint32_t FixupCount = 0;
+		uint64_t Image = 0;//Offset on the images
+		uint64_t ImageSize = 0;
+		uint64_t Instances = 0;//Storage hints of components, zero when there isn't one
+		uint32_t Chunk = 0;
+		uint32_t Align = 0;
+		uint32_t Storage = 0;//StorageKind, 0 for dense & 1 for sparse
+		uint32_t Padding = 0;
+	};
+
+	struct Field {
+		String Name;
+		String CppName;
+		String TypeName;
+		String Default;//Only for strings
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+		uint32_t Type = 0;//FieldType
+		uint32_t Padding = 0;
+		uint64_t Min = 0;//Raw bits of MinInt, MinUint, MinFloat or Length depending on Type
+		uint64_t Max = 0;//Raw bits of MaxInt, MaxUint or MaxFloat depending on Type
+	};
+
+	/**
+	* @brief Bytes of an object that are covered by its default image
+	* @details Ranges of an object are in the same order as their bytes on the image
+	*/
+	struct Range {
+		uint64_t Offset = 0;
+		uint64_t Size = 0;
+	};
+
+	struct Enum {
+		String Name;
+		String CppName;
+		uint64_t Size = 0;
+		uint32_t Type = 0;//FieldType
+		uint32_t FirstValue = 0;
+		uint32_t ValueCount = 0;
+		uint32_t Padding = 0;
+	};
+
+	struct EnumValue {
+		String Name;
+		uint64_t Value = 0;//Raw bits of either Value or Uvalue
+	};
+
+	/**
+	* @brief Small segment that points to the current generation of the model
+	* @details gtreflect writes every generation on a new segment and publishes it by storing
+	*	its number here. Readers load the generation, map the segment with that suffix and check that
+	*	its header has the same generation, otherwise they load the generation again.
+	*/
+	struct Control {
+		uint32_t Magic = ControlMagic;
+		uint32_t Version = FormatVersion;
+		std::atomic<uint64_t> Generation{ 0 };
+	};
+
+	static_assert(std::atomic<uint64_t>::is_always_lock_free, "gtr::flat::Control must be lock free to be shared between processes");
+	static_assert(sizeof(Header) == 136, "Layout of gtr::flat::Header must not change");
+	static_assert(sizeof(Object) == 120, "Layout of gtr::flat::Object must not change");
+	static_assert(sizeof(Field) == 72, "Layout of gtr::flat::Field must not change");
+	static_assert(sizeof(Range) == 16, "Layout of gtr::flat::Range must not change");
+	static_assert(sizeof(Enum) == 40, "Layout of gtr::flat::Enum must not change");
+	static_assert(sizeof(EnumValue) == 16, "Layout of gtr::flat::EnumValue must not change");
+
+	[[nodiscard]] inline const Header* GetHeader(const void* base) noexcept
+	{
+		const auto* header = static_cast<const Header*>(base);
+		return header->Magic == Magic && header->Version == FormatVersion ? header : nullptr;
+	}
+
+	template<typename T>
+	[[nodiscard]] inline const T* GetArray(const void* base, uint64_t offset) noexcept { return reinterpret_cast<const T*>(static_cast<const uint8_t*>(base) + offset); }
+
+	[[nodiscard]] inline const char* GetString(const void* base, const String& str) noexcept
+	{
+		return GetArray<char>(base, GetHeader(base)->Strings + str.Offset);
+	}
+
+	/**
+	* @brief Binary search over count entries sorted by the string that key() returns for each index
+	* @return Index of the entry or UINT32_MAX if there isn't one
+	*/
+	template<typename Key>
+	[[nodiscard]] inline uint32_t Search(const void* base, uint32_t count, const char* name, Key key) noexcept
+	{
+		uint32_t first = 0, last = count;
+		while (first < last)
+		{
+			const uint32_t middle = first + (last - first) / 2;
+			const int result = strcmp(GetString(base, key(middle)), name);
+			if (result == 0)
+				return middle;
+			else if (result < 0)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+		return UINT32_MAX;
+	}
+
+	[[nodiscard]] inline const Object* FindObject(const void* base, const char* name) noexcept
+	{
+		const Header* header = GetHeader(base);
+		const Object* objects = GetArray<Object>(base, header->Objects);
+		const uint32_t index = Search(base, header->ObjectCount, name, [objects](uint32_t i) { return objects[i].Name; });
+		return index != UINT32_MAX ? &objects[index] : nullptr;
+	}
+
+	[[nodiscard]] inline const Object* FindObjectById(const void* base, const char* id) noexcept
+	{
+		const Header* header = GetHeader(base);
+		const Object* objects = GetArray<Object>(base, header->Objects);
+		const uint32_t* ids = GetArray<uint32_t>(base, header->Ids);
+		const uint32_t index = Search(base, header->ObjectCount, id, [objects, ids](uint32_t i) { return objects[ids[i]].Id; });
+		return index != UINT32_MAX ? &objects[ids[index]] : nullptr;
+	}
+
+	[[nodiscard]] inline const Enum* FindEnum(const void* base, const char* name) noexcept
+	{
+		const Header* header = GetHeader(base);
+		const Enum* enums = GetArray<Enum>(base, header->Enums);
+		const uint32_t index = Search(base, header->EnumCount, name, [enums](uint32_t i) { return enums[i].Name; });
+		return index != UINT32_MAX ? &enums[index] : nullptr;
+	}
+
+} }
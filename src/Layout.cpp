@@ -0,0 +1,314 @@
+#include "Layout.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <numeric>
+
+[[nodiscard]] static bool is_padding(const Object& obj, size_t start, size_t end) noexcept;
+
+[[nodiscard]] bool isTriviallyCopyable(FieldType type) noexcept
+{
+	switch (type)
+	{
+	case FieldType::Unknown:
+	case FieldType::String:
+	case FieldType::Asset:
+	case FieldType::Entity:
+		return false;
+	default:
+		return true;
+	}
+}
+
+[[nodiscard]] std::vector<ByteRange> PodRanges(const Object& obj) noexcept
+{
+	std::vector<const Field*> fields;
+	for (const auto& field : obj.Fields)
+	{
+		if (isTriviallyCopyable(field.Meta.ValueType))
+			fields.push_back(&field);
+	}
+	std::sort(fields.begin(), fields.end(), [](const Field* lhs, const Field* rhs) { return lhs->Offset < rhs->Offset; });
+
+	std::vector<ByteRange> ranges;
+	for (const Field* field : fields)
+	{
+		if (!ranges.empty())
+		{
+			auto& last = ranges.back();
+			const size_t end = last.Offset + last.Size;
+			if (is_padding(obj, end, field->Offset))
+			{
+				last.Size = std::max(end, field->Offset + field->Meta.Size) - last.Offset;
+				continue;
+			}
+		}
+		ranges.push_back({ field->Offset, field->Meta.Size });
+	}
+	return ranges;
+}
+
+[[nodiscard]] bool isTriviallyCopyable(const Object& obj) noexcept
+{
+	if (obj.Layout.empty() || obj.Fields.empty())
+		return false;
+
+	//Every member must be a reflected field that can be copied
+	for (const auto& member : obj.Layout)
+	{
+		const auto it = std::find_if(obj.Fields.begin(), obj.Fields.end(), [&member](const Field& field)
+		{
+			return field.Offset == member.Offset && field.Meta.Size == member.Size;
+		});
+		if (it == obj.Fields.end() || !isTriviallyCopyable(it->Meta.ValueType))
+			return false;
+	}
+	return true;
+}
+
+[[nodiscard]] bool is_padding(const Object& obj, size_t start, size_t end) noexcept
+{
+	if (start >= end)//Touching or overlapping
+		return true;
+
+	//Without the layout we can't tell what is between the two fields
+	if (obj.Layout.empty())
+		return false;
+
+	for (const auto& member : obj.Layout)
+	{
+		if (member.Offset < end && start < member.Offset + member.Size)
+			return false;
+	}
+	return true;
+}
+
+template<typename T, typename V>
+static void bake(uint8_t* dst, const YAML::Node& node) noexcept
+{
+	const T value = node.IsDefined() && !node.IsNull() ? (T)node.as<V>() : T{};
+	memcpy(dst, &value, sizeof(T));
+}
+
+template<size_t N>
+static void bake_vec(uint8_t* dst, const YAML::Node& node) noexcept
+{
+	float values[N] = { 0.0f };
+	if (node.IsSequence() && node.size() == N)
+	{
+		for (size_t i = 0; i < N; i++)
+			values[i] = node[i].as<float>();
+	}
+	memcpy(dst, values, sizeof(values));
+}
+
+[[nodiscard]] ReferenceOffsets GatherReferences(const Object& obj) noexcept
+{
+	ReferenceOffsets references;
+	for (const auto& field : obj.Fields)
+	{
+		if (field.Meta.ValueType == FieldType::Entity)
+			references.Entities.push_back(field.Offset);
+		else if (field.Meta.ValueType == FieldType::Asset)
+			references.Assets.push_back(field.Offset);
+	}
+	std::sort(references.Entities.begin(), references.Entities.end());
+	std::sort(references.Assets.begin(), references.Assets.end());
+	return references;
+}
+
+[[nodiscard]] DefaultImage BakeDefaults(const Object& obj) noexcept
+{
+	DefaultImage image;
+	image.Ranges = PodRanges(obj);
+
+	size_t total = 0;
+	std::vector<size_t> starts;
+	for (const auto& range : image.Ranges)
+	{
+		starts.push_back(total);
+		total += range.Size;
+	}
+	image.Bytes.resize(total, 0);
+
+	for (size_t i = 0; i < obj.Fields.size(); i++)
+	{
+		const auto& field = obj.Fields[i];
+		if (!isTriviallyCopyable(field.Meta.ValueType))
+		{
+			image.Fixups.push_back(i);
+			continue;
+		}
+
+		//Find the range that holds the field
+		size_t r = 0;
+		while (r < image.Ranges.size() && image.Ranges[r].Offset + image.Ranges[r].Size <= field.Offset)
+			r++;
+		GTR_ASSERT_OR(r < image.Ranges.size(), image, "Field %s of %s is outside of the default image.\n", field.Name.c_str(), obj.Name.c_str());
+
+		uint8_t* dst = image.Bytes.data() + starts[r] + (field.Offset - image.Ranges[r].Offset);
+		const YAML::Node node = field.Default["Default"];
+		switch (field.Meta.ValueType)
+		{
+		case FieldType::Bool:		bake<bool, bool>(dst, node); break;
+		case FieldType::Char:
+		case FieldType::Enum_Char:	bake<int8_t, int64_t>(dst, node); break;
+		case FieldType::Int16:
+		case FieldType::Enum_Int16:	bake<int16_t, int64_t>(dst, node); break;
+		case FieldType::Int32:
+		case FieldType::Enum_Int32:	bake<int32_t, int64_t>(dst, node); break;
+		case FieldType::Int64:
+		case FieldType::Enum_Int64:	bake<int64_t, int64_t>(dst, node); break;
+		case FieldType::Byte:
+		case FieldType::Enum_Byte:	bake<uint8_t, uint64_t>(dst, node); break;
+		case FieldType::Uint16:
+		case FieldType::Enum_Uint16:	bake<uint16_t, uint64_t>(dst, node); break;
+		case FieldType::Uint32:
+		case FieldType::Enum_Uint32:	bake<uint32_t, uint64_t>(dst, node); break;
+		case FieldType::Uint64:
+		case FieldType::Enum_Uint64:	bake<uint64_t, uint64_t>(dst, node); break;
+		case FieldType::Float32:	bake<float, double>(dst, node); break;
+		case FieldType::Float64:	bake<double, double>(dst, node); break;
+		case FieldType::Vec2:		bake_vec<2>(dst, node); break;
+		case FieldType::Vec3:		bake_vec<3>(dst, node); break;
+		case FieldType::Vec4:		bake_vec<4>(dst, node); break;
+		default:
+			break;
+		}
+	}
+	return image;
+}
+
+[[nodiscard]] size_t DefaultImage::Locate(size_t offset) const noexcept
+{
+	size_t start = 0;
+	for (const auto& range : Ranges)
+	{
+		if (offset >= range.Offset && offset < range.Offset + range.Size)
+			return start + (offset - range.Offset);
+		start += range.Size;
+	}
+	return SIZE_MAX;
+}
+
+[[nodiscard]] static size_t align_to(size_t offset, size_t align) noexcept { return align > 1 ? (offset + align - 1) / align * align : offset; }
+
+[[nodiscard]] LayoutAnalysis AnalyzeLayout(const Object& obj) noexcept
+{
+	LayoutAnalysis analysis;
+	analysis.Size = obj.Meta.Size;
+	analysis.Reordered = obj.Meta.Size;
+	if (obj.Layout.empty() || obj.Meta.Size == 0)
+		return analysis;
+
+	std::vector<const MemberLayout*> members;
+	for (const auto& member : obj.Layout)
+		members.push_back(&member);
+	std::stable_sort(members.begin(), members.end(), [](const MemberLayout* lhs, const MemberLayout* rhs) { return lhs->Offset < rhs->Offset; });
+
+	//Members may overlap (bit-fields & empty bases), so holes are measured from the furthest end so far
+	size_t end = 0;
+	const MemberLayout* last = nullptr;
+	for (const MemberLayout* member : members)
+	{
+		if (member->Offset > end)
+			analysis.Holes.push_back({ last ? last->Name : "", end, member->Offset - end });
+		if (member->Offset + member->Size > end)
+		{
+			end = member->Offset + member->Size;
+			last = member;
+		}
+	}
+	if (analysis.Size > end)
+		analysis.Holes.push_back({ last ? last->Name : "", end, analysis.Size - end });
+	for (const auto& hole : analysis.Holes)
+		analysis.Padding += hole.Size;
+
+	//Bases & vptr stay where they are, fields follow sorted by alignment and then by size
+	size_t offset = 0, align = 1;
+	std::vector<const MemberLayout*> fields;
+	for (const MemberLayout* member : members)
+	{
+		align = std::max(align, member->Align);
+		if (member->Movable)
+			fields.push_back(member);
+		else
+			offset = std::max(offset, member->Offset + member->Size);
+	}
+	std::stable_sort(fields.begin(), fields.end(), [](const MemberLayout* lhs, const MemberLayout* rhs)
+	{
+		if (lhs->Align != rhs->Align) return lhs->Align > rhs->Align;
+		return lhs->Size > rhs->Size;
+	});
+	for (const MemberLayout* field : fields)
+		offset = align_to(offset, field->Align) + field->Size;
+	analysis.Reordered = std::min(analysis.Size, align_to(offset, align));
+
+	//Instances of a packed array line up with cache lines again every Period instances
+	const size_t period = CacheLineSize / std::gcd(analysis.Size, CacheLineSize);
+	for (const MemberLayout* member : members)
+	{
+		if (member->Size == 0 || member->Size > CacheLineSize)
+			continue;
+		size_t count = 0;
+		for (size_t i = 0; i < period; i++)
+		{
+			if ((i * analysis.Size + member->Offset) % CacheLineSize + member->Size > CacheLineSize)
+				count++;
+		}
+		if (count)
+			analysis.Straddles.push_back({ member->Name, count, period });
+	}
+	return analysis;
+}
+
+void WriteLayoutReport(std::ostream& os, const std::unordered_map<std::string, Object>& objects) noexcept
+{
+	std::vector<std::pair<const Object*, LayoutAnalysis>> components;
+	size_t width = 9;
+	for (const auto& [name, obj] : objects)
+	{
+		if (obj.Meta.Type != ReflectionType::Component)
+			continue;
+		components.push_back({ &obj, AnalyzeLayout(obj) });
+		width = std::max(width, obj.Name.size());
+	}
+	std::sort(components.begin(), components.end(), [](const auto& lhs, const auto& rhs) { return lhs.first->Name < rhs.first->Name; });
+
+	os << "Layout of components (cache lines of " << CacheLineSize << " bytes)\n\n";
+	for (const auto& [obj, analysis] : components)
+	{
+		os << obj->Name << ": " << analysis.Size << " bytes, " << analysis.Padding << " bytes of padding, " << analysis.Reordered << " bytes when reordered\n";
+		for (const auto& hole : analysis.Holes)
+		{
+			os << '\t' << hole.Size << (hole.Size == 1 ? " byte" : " bytes") << " of padding at " << hole.Offset;
+			if (hole.Offset + hole.Size == analysis.Size)
+				os << " (tail)";
+			if (!hole.After.empty())
+				os << ", after " << hole.After;
+			os << '\n';
+		}
+		for (const auto& straddle : analysis.Straddles)
+			os << '\t' << straddle.Name << " spans two cache lines on " << straddle.Count << " of every " << straddle.Period << " instances\n";
+		os << '\n';
+	}
+
+	//Weighted by how many instances there are, so dense components come first
+	const auto wasted = [](const Object* obj, const LayoutAnalysis& analysis) { return analysis.Padding * std::max<uint64_t>(obj->Storage.Instances, 1); };
+	std::stable_sort(components.begin(), components.end(), [&wasted](const auto& lhs, const auto& rhs)
+	{
+		return wasted(lhs.first, lhs.second) > wasted(rhs.first, rhs.second);
+	});
+
+	os << "Summary (sorted by padding x instances)\n" << std::left <<
+		std::setw(width) << "Component" << std::right <<
+		std::setw(8) << "Size" << std::setw(10) << "Padding" << std::setw(12) << "Reordered" << std::setw(12) << "Straddling" <<
+		std::setw(12) << "Instances" << std::setw(14) << "Wasted" << '\n';
+	for (const auto& [obj, analysis] : components)
+	{
+		os << std::left << std::setw(width) << obj->Name << std::right <<
+			std::setw(8) << analysis.Size << std::setw(10) << analysis.Padding << std::setw(12) << analysis.Reordered << std::setw(12) << analysis.Straddles.size() <<
+			std::setw(12) << (obj->Storage.Instances ? std::to_string(obj->Storage.Instances) : "-") << std::setw(14) << wasted(obj, analysis) << '\n';
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "reflect.h"
+
+#include <ostream>
+#include <unordered_map>
+
+struct ByteRange {
+	size_t Offset = 0;
+	size_t Size = 0;
+};
+
+/**
+* @brief Checks whether fields of the given type can be copied as plain bytes
+*/
+[[nodiscard]] bool isTriviallyCopyable(FieldType type) noexcept;
+
+/**
+* @brief Coalesces the trivially copyable fields of an object into ranges
+* @details Neighbouring fields end up on the same range when there is nothing but padding between them,
+*	so each range can be copied with a single memcpy
+*/
+[[nodiscard]] std::vector<ByteRange> PodRanges(const Object& obj) noexcept;
+
+/**
+* @brief Checks whether every byte of the object (except padding) belongs to a trivially copyable field
+* @details Arrays of such objects can be copied as a whole
+*/
+[[nodiscard]] bool isTriviallyCopyable(const Object& obj) noexcept;
+
+/**
+* @brief Prebaked bytes of the default-initialized trivially copyable fields of an object
+* @details The Engine copies Bytes over Ranges (they are in the same order, one after the other)
+*	and then sets the Fixups, which are indices of the fields that can't be copied as bytes.
+*/
+struct DefaultImage {
+	std::vector<ByteRange> Ranges;
+	std::vector<uint8_t> Bytes;
+	std::vector<size_t> Fixups;
+
+	/**
+	* @brief Finds where the byte at the given offset of the object is stored on Bytes
+	* @return Position on Bytes or SIZE_MAX if the offset isn't covered by any range
+	*/
+	[[nodiscard]] size_t Locate(size_t offset) const noexcept;
+};
+
+/**
+* @brief Bakes the defaults of every field of the object
+* @details Uses the Default node that is set on PostbuildFinder::FoundField
+*/
+[[nodiscard]] DefaultImage BakeDefaults(const Object& obj) noexcept;
+
+/**
+* @brief Offsets of the fields of an object that refer to entities and to assets
+* @details Sorted, so passes that remap entities or collect assets touch only those bytes and in order
+*/
+struct ReferenceOffsets {
+	std::vector<size_t> Entities;
+	std::vector<size_t> Assets;
+};
+
+[[nodiscard]] ReferenceOffsets GatherReferences(const Object& obj) noexcept;
+
+/**
+* @brief Where the bytes of a component go
+* @details Computed from Object::Layout, so members that aren't reflected are also taken into account
+*/
+struct LayoutAnalysis {
+	size_t Size = 0;
+	size_t Padding = 0;//Bytes that don't belong to any member, including the tail
+	size_t Reordered = 0;//Size when fields are sorted by alignment, bases & vptr stay in front
+
+	struct Hole {
+		std::string After;//Empty for padding at the beginning
+		size_t Offset = 0;
+		size_t Size = 0;
+	};
+	std::vector<Hole> Holes;
+
+	/**
+	* @brief Member that spans two cache lines on some of the instances of a tightly packed array
+	* @details Arrays are assumed to start on a cache line, so the pattern repeats every Period instances
+	*/
+	struct Straddle {
+		std::string Name;
+		size_t Count = 0;
+		size_t Period = 0;
+	};
+	std::vector<Straddle> Straddles;
+};
+
+constexpr size_t CacheLineSize = 64;
+
+[[nodiscard]] LayoutAnalysis AnalyzeLayout(const Object& obj) noexcept;
+
+/**
+* @brief Writes the analysis of every component followed by a summary
+* @details Summary is sorted by padding times the instances hint (1 when there isn't one)
+*/
+void WriteLayoutReport(std::ostream& os, const std::unordered_map<std::string, Object>& objects) noexcept;
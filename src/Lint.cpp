@@ -0,0 +1,224 @@
+#include "Lint.h"
+#include "Layout.h"
+
+#include <unordered_set>
+
+#pragma warning(push)
+#pragma warning(disable: 4146)
+#pragma warning(disable: 4244 4267 4291)
+#pragma warning(disable: 4624)
+#include <clang/AST/ASTContext.h>
+#include <clang/AST/RecursiveASTVisitor.h>
+#pragma warning(pop)
+
+//Member functions that the Engine calls every frame
+static const std::unordered_set<std::string> sUpdateFunctions = {
+	"OnUpdate", "Update",
+	"OnFixedUpdate", "FixedUpdate",
+	"OnLateUpdate", "LateUpdate",
+	"OnTick", "Tick"
+};
+
+[[nodiscard]] static const char* code(LintKind kind) noexcept
+{
+	switch (kind)
+	{
+	case LintKind::New:			return "GTR001";
+	case LintKind::Container:	return "GTR002";
+	case LintKind::MakeShared:	return "GTR003";
+	case LintKind::Function:	return "GTR004";
+	case LintKind::LargeCopy:	return "GTR005";
+	default:					return "GTR000";
+	}
+}
+
+/**
+* @brief Checks whether the expression initializes a static local, which is only done once
+*/
+[[nodiscard]] static bool is_static_init(clang::ASTContext& context, const clang::Stmt* stmt) noexcept
+{
+	using namespace clang;
+
+	const Stmt* current = stmt;
+	while (true)
+	{
+		const auto parents = context.getParents(*current);
+		if (parents.empty())
+			return false;
+		if (const auto* var = parents[0].get<VarDecl>())
+			return var->isStaticLocal();
+		const Stmt* parent = parents[0].get<Stmt>();
+		if (!parent || !(isa<ImplicitCastExpr>(parent) || isa<ExprWithCleanups>(parent) || isa<MaterializeTemporaryExpr>(parent) || isa<CXXBindTemporaryExpr>(parent)))
+			return false;
+		current = parent;
+	}
+}
+
+class LintVisitor : public clang::RecursiveASTVisitor<LintVisitor> {
+public:
+	LintVisitor(clang::ASTContext& context, std::vector<LintIssue>& issues, const std::string& object) noexcept
+		: mContext(context), mIssues(issues), mObject(object) {}
+
+	/**
+	* @brief Visits the body of an update-style function and of the functions of the project that it calls
+	*/
+	void Visit(const clang::FunctionDecl* function) noexcept
+	{
+		mFunction = function->getNameAsString();
+		mPending.push_back(function);
+		while (!mPending.empty())
+		{
+			const auto* current = mPending.back();
+			mPending.pop_back();
+			const clang::FunctionDecl* definition = nullptr;
+			if (current->hasBody(definition) && mVisited.insert(definition).second)
+				TraverseStmt(definition->getBody());
+		}
+	}
+
+	bool VisitCXXNewExpr(clang::CXXNewExpr* expr) noexcept
+	{
+		const auto* allocator = expr->getOperatorNew();
+		if (allocator && allocator->isReservedGlobalPlacementOperator())
+			return true;
+		Report(LintKind::New, expr, "'new " + expr->getAllocatedType().getAsString() + "' allocates on every call");
+		return true;
+	}
+
+	bool VisitCallExpr(clang::CallExpr* call) noexcept
+	{
+		const auto* callee = call->getDirectCallee();
+		if (!callee)
+			return true;
+
+		const auto name = callee->getNameAsString();
+		if (callee->isInStdNamespace() && (name == "make_shared" || name == "make_unique" || name == "allocate_shared"))
+		{
+			Report(LintKind::MakeShared, call, "'std::" + name + "' allocates on every call");
+			return true;
+		}
+
+		//Only functions of the project are followed
+		const auto& sm = mContext.getSourceManager();
+		if (sm.isInMainFile(sm.getExpansionLoc(callee->getLocation())))
+			mPending.push_back(callee);
+		return true;
+	}
+
+	bool VisitCXXConstructExpr(clang::CXXConstructExpr* expr) noexcept
+	{
+		const auto* constructor = expr->getConstructor();
+		const auto* record = constructor->getParent();
+		if (constructor->isMoveConstructor() || is_static_init(mContext, expr))
+			return true;
+
+		const auto name = record->getNameAsString();
+		if (record->isInStdNamespace() && (name == "basic_string" || name == "vector"))
+			Report(LintKind::Container, expr, "'" + expr->getType().getUnqualifiedType().getAsString() + "' is constructed on every call");
+		else if (record->getQualifiedNameAsString() == "dumm::String")//std::string on clangdump.hpp
+			Report(LintKind::Container, expr, "'std::string' is constructed on every call");
+		else if (record->isInStdNamespace() && name == "function" && !constructor->isCopyConstructor() && expr->getNumArgs() > 0)
+		{
+			const auto* arg = expr->getArg(0)->IgnoreImplicit();
+			const auto* lambda = clang::dyn_cast<clang::LambdaExpr>(arg);
+			if (!lambda || lambda->capture_size() > 0)
+				Report(LintKind::Function, expr, "'std::function' is constructed from a callable with captures, which may allocate on every call");
+		}
+		else if (constructor->isCopyConstructor() && record->hasAttr<clang::AnnotateAttr>())
+		{
+			const size_t size = (size_t)mContext.getTypeSize(expr->getType()) / 8;
+			if (size > CacheLineSize)
+				Report(LintKind::LargeCopy, expr, "'" + name + "' (" + std::to_string(size) + " bytes) is copied by value, take it by reference instead");
+		}
+		return true;
+	}
+
+private:
+
+	void Report(LintKind kind, const clang::Stmt* stmt, const std::string& message) noexcept
+	{
+		const auto& sm = mContext.getSourceManager();
+		const auto location = sm.getPresumedLoc(sm.getExpansionLoc(stmt->getBeginLoc()));
+
+		LintIssue issue;
+		issue.Kind = kind;
+		if (location.isValid())
+		{
+			issue.File = location.getFilename();
+			issue.Line = location.getLine();
+			issue.Column = location.getColumn();
+		}
+		issue.Object = mObject;
+		issue.Function = mFunction;
+		issue.Message = message;
+		mIssues.push_back(issue);
+	}
+
+private:
+	clang::ASTContext& mContext;
+	std::vector<LintIssue>& mIssues;
+	std::string mObject;
+	std::string mFunction;
+	std::unordered_set<const clang::FunctionDecl*> mVisited;
+	std::vector<const clang::FunctionDecl*> mPending;
+};
+
+[[nodiscard]] std::vector<LintIssue> LintAllocations(const clang::CXXRecordDecl* record) noexcept
+{
+	std::vector<LintIssue> issues;
+	LintVisitor visitor(record->getASTContext(), issues, record->getNameAsString());
+	for (const auto* method : record->methods())
+	{
+		if (method->hasBody() && sUpdateFunctions.count(method->getNameAsString()))
+			visitor.Visit(method);
+	}
+	return issues;
+}
+
+void WriteLintWarnings(std::ostream& os, const std::vector<LintIssue>& issues) noexcept
+{
+	for (const auto& issue : issues)
+	{
+		os << issue.File << '(' << issue.Line << ',' << issue.Column << "): warning " << code(issue.Kind) << ": " <<
+			issue.Message << " [" << issue.Object << "::" << issue.Function << "]\n";
+	}
+}
+
+/**
+* @brief Writes a JSON string, escaping what needs to be
+*/
+static void write_string(std::ostream& os, const std::string& str) noexcept
+{
+	os << '"';
+	for (const char c : str)
+	{
+		switch (c)
+		{
+		case '"':	os << "\\\""; break;
+		case '\\':	os << "\\\\"; break;
+		case '\n':	os << "\\n"; break;
+		case '\t':	os << "\\t"; break;
+		default:	os << c; break;
+		}
+	}
+	os << '"';
+}
+
+void WriteLintJson(std::ostream& os, const std::vector<LintIssue>& issues) noexcept
+{
+	os << "[\n";
+	for (size_t i = 0; i < issues.size(); i++)
+	{
+		const auto& issue = issues[i];
+		os << "\t{ \"code\": \"" << code(issue.Kind) << "\", \"file\": ";
+		write_string(os, issue.File);
+		os << ", \"line\": " << issue.Line << ", \"column\": " << issue.Column << ", \"object\": ";
+		write_string(os, issue.Object);
+		os << ", \"function\": ";
+		write_string(os, issue.Function);
+		os << ", \"message\": ";
+		write_string(os, issue.Message);
+		os << " }" << (i + 1 < issues.size() ? ",\n" : "\n");
+	}
+	os << "]\n";
+}
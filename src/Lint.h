@@ -0,0 +1,42 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace clang { class CXXRecordDecl; }
+
+enum class LintKind : unsigned char {
+	New,//Heap allocation with new
+	Container,//Construction of a std::string or std::vector
+	MakeShared,//std::make_shared, std::make_unique or std::allocate_shared
+	Function,//std::function constructed from a callable, which may allocate its captures
+	LargeCopy//Copy by value of a reflected object bigger than a cache line
+};
+
+struct LintIssue {
+	LintKind Kind = LintKind::New;
+	std::string File;
+	unsigned Line = 0;
+	unsigned Column = 0;
+	std::string Object;//Script or system
+	std::string Function;//Update-style member function that reaches the issue
+	std::string Message;
+};
+
+/**
+* @brief Looks for per-frame allocations on the update-style member functions of a script or system
+* @details OnUpdate, OnFixedUpdate, OnLateUpdate and the likes are walked, together with the functions of
+*	the project that they call. Constructions that are done once (static locals) and moves are skipped.
+*/
+[[nodiscard]] std::vector<LintIssue> LintAllocations(const clang::CXXRecordDecl* record) noexcept;
+
+/**
+* @brief Writes every issue as a warning that IDEs can jump to
+*/
+void WriteLintWarnings(std::ostream& os, const std::vector<LintIssue>& issues) noexcept;
+
+/**
+* @brief Writes every issue as an array of JSON objects
+*/
+void WriteLintJson(std::ostream& os, const std::vector<LintIssue>& issues) noexcept;
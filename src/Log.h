@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace gtr {
+
+	/**
+	* @brief Output of a run that shares the process with other runs
+	* @details BatchRun() gives one to each project, so the output of projects that run at the same time
+	*	doesn't interleave and a failed GTR_ASSERT fails that project instead of the whole process.
+	*/
+	struct RunLog {
+		std::string Text;
+		bool Failed = false;//A GTR_ASSERT failed, the run stops at the next check of gtr::Failed()
+	};
+
+	//Log of the run on the current thread, nullptr prints straight away
+	inline thread_local RunLog* tRunLog = nullptr;
+
+	/**
+	* @brief Whether a GTR_ASSERT failed on the run of the current thread
+	* @details GTR_ASSERT only returns from the function that failed, so callers that go on check it
+	*	(the finders on every callback, the steps after each parse)
+	*/
+	[[nodiscard]] inline bool Failed(void) noexcept { return tRunLog && tRunLog->Failed; }
+
+	inline void vlog(FILE* stream, const char* format, va_list args) noexcept
+	{
+		if (!tRunLog)
+		{
+			vfprintf(stream, format, args);
+			return;
+		}
+		va_list copy;
+		va_copy(copy, args);
+		const int size = vsnprintf(nullptr, 0, format, copy);
+		va_end(copy);
+		if (size <= 0)
+			return;
+		const size_t start = tRunLog->Text.size();
+		tRunLog->Text.resize(start + size + 1);
+		vsnprintf(tRunLog->Text.data() + start, size + 1, format, args);
+		tRunLog->Text.resize(start + size);
+	}
+
+	/**
+	* @brief Same as printf, but goes to the log of the run when there is one
+	*/
+	inline void Log(const char* format, ...) noexcept
+	{
+		va_list args;
+		va_start(args, format);
+		vlog(stdout, format, args);
+		va_end(args);
+	}
+
+	/**
+	* @brief Same as fprintf on stderr, but goes to the log of the run when there is one
+	*/
+	inline void LogError(const char* format, ...) noexcept
+	{
+		va_list args;
+		va_start(args, format);
+		vlog(stderr, format, args);
+		va_end(args);
+	}
+
+	/**
+	* @brief Logs the message of a failed GTR_ASSERT and ends the run
+	* @details Exits, unless the run has a log: then the run is marked as failed and only its first failure is logged
+	*/
+	inline void Fail(const char* format, ...) noexcept
+	{
+		if (Failed())
+			return;
+		va_list args;
+		va_start(args, format);
+		vlog(stderr, format, args);
+		va_end(args);
+		if (!tRunLog)
+			exit(EXIT_FAILURE);
+		tRunLog->Failed = true;
+	}
+
+}
@@ -0,0 +1,49 @@
+#include "Manifest.h"
+#include "Artifacts.h"
+#include "reflect.h"
+
+#include <ctime>
+
+static void output_changes(YAML::Emitter& out, const char* key, const std::vector<ObjectChange>& changes) noexcept;
+
+void ChangeManifest::Write(std::ostream& os) const noexcept
+{
+	YAML::Emitter out;
+	std::time_t result = std::time(nullptr);
+	const auto comment = "Auto Generated file by gtreflect.exe at " + Timestamp();
+	out << YAML::Comment(comment);
+	out << YAML::BeginMap;
+	out << YAML::Key << "Build" << YAML::Value << (uint64_t)result;
+	out << YAML::Key << "Objects" << YAML::Value << YAML::BeginMap;
+	output_changes(out, "Added", Added);
+	output_changes(out, "Removed", Removed);
+	output_changes(out, "Renamed", Renamed);
+	output_changes(out, "Modified", Modified);
+	out << YAML::EndMap;
+	out << YAML::Key << "Enums" << YAML::Value << YAML::BeginMap;
+	out << YAML::Key << "Added" << YAML::Value << YAML::Flow << AddedEnums;
+	out << YAML::Key << "Removed" << YAML::Value << YAML::Flow << RemovedEnums;
+	out << YAML::Key << "Modified" << YAML::Value << YAML::Flow << ModifiedEnums;
+	out << YAML::EndMap;
+	out << YAML::EndMap;
+
+	os << out.c_str();
+}
+
+void output_changes(YAML::Emitter& out, const char* key, const std::vector<ObjectChange>& changes) noexcept
+{
+	out << YAML::Key << key << YAML::Value << YAML::BeginSeq;
+	for (const auto& change : changes)
+	{
+		out << YAML::BeginMap;
+		out << YAML::Key << "Name" << YAML::Value << change.Name;
+		if (!change.OldName.empty())
+			out << YAML::Key << "OldName" << YAML::Value << change.OldName;
+		out << YAML::Key << "Id" << YAML::Value << change.Id;
+		out << YAML::Key << "Path" << YAML::Value << change.Path;
+		out << YAML::Key << "From" << YAML::Value << change.From;
+		out << YAML::Key << "Version" << YAML::Value << change.Version;
+		out << YAML::EndMap;
+	}
+	out << YAML::EndSeq;
+}
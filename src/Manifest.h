@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+* @brief A single object that changed on this build
+*/
+struct ObjectChange {
+	std::string Name;
+	std::string OldName;//Only for renamed objects
+	std::string Id;
+	std::string Path;//Relative to Assets/
+	uint64_t From = 0;//Previous version, 0 for new objects
+	uint64_t Version = 0;
+};
+
+/**
+* @brief Everything that changed on the reflection data during a postbuild step
+* @details Written on .gt/changes.manifest so the Engine can reload only what is affected
+*/
+struct ChangeManifest {
+	std::vector<ObjectChange> Added;
+	std::vector<ObjectChange> Removed;
+	std::vector<ObjectChange> Renamed;
+	std::vector<ObjectChange> Modified;
+
+	std::vector<std::string> AddedEnums;
+	std::vector<std::string> RemovedEnums;
+	std::vector<std::string> ModifiedEnums;
+
+	void Write(std::ostream& os) const noexcept;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+/**
+* @brief Read-only mapping of a whole file
+* @details Data() is null when the file doesn't exist or is empty
+*/
+class MappedFile {
+public:
+	MappedFile(const std::filesystem::path& filepath) noexcept;
+	~MappedFile(void);
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	[[nodiscard]] const uint8_t* Data(void) const noexcept { return mData; }
+	[[nodiscard]] size_t Size(void) const noexcept { return mSize; }
+
+	/**
+	* @brief Unmaps the file, which must be done before it is written again on Windows
+	*/
+	void Close(void) noexcept;
+
+private:
+	const uint8_t* mData = nullptr;
+	size_t mSize = 0;
+#ifdef _WIN32
+	void* mFile = nullptr;
+	void* mMapping = nullptr;
+#endif
+};
@@ -0,0 +1,149 @@
+#include "Migration.h"
+#include "Layout.h"
+
+#include <algorithm>
+
+[[nodiscard]] static bool is_numeric(FieldType type) noexcept;
+[[nodiscard]] static bool is_vector(FieldType type) noexcept;
+
+[[nodiscard]] Migration Diff(const Object& old, const Object& obj) noexcept
+{
+	Migration migration;
+	migration.From = old.Version;
+
+	//Match fields by name
+	std::vector<bool> found(obj.Fields.size(), false);
+	for (size_t i = 0; i < old.Fields.size(); i++)
+	{
+		const auto& oldfield = old.Fields[i];
+		size_t j = 0;
+		while (j < obj.Fields.size() && (found[j] || obj.Fields[j].Meta.Name.compare(oldfield.Meta.Name) != 0))
+			j++;
+		if (j == obj.Fields.size())
+		{
+			migration.Removed.push_back(i);
+			continue;
+		}
+
+		const auto& field = obj.Fields[j];
+		const FieldType from = oldfield.Meta.ValueType;
+		const FieldType to = field.Meta.ValueType;
+		if (from == to && oldfield.Meta.Size == field.Meta.Size)
+			migration.Matched.emplace_back(i, j);
+		else if ((is_numeric(from) && is_numeric(to)) || (is_vector(from) && is_vector(to)))
+			migration.Changed.emplace_back(i, j);
+		else//Can't be converted so we treat it as a new field
+		{
+			migration.Removed.push_back(i);
+			continue;
+		}
+		found[j] = true;
+	}
+	for (size_t j = 0; j < obj.Fields.size(); j++)
+	{
+		if (!found[j])
+			migration.Added.push_back(j);
+	}
+
+	auto& program = migration.Program;
+	auto push = [&program](MigrationOp op, uint64_t a, uint64_t b, uint64_t c) { program.push_back({ (uint64_t)op, a, b, c }); };
+
+	//Copy matched fields, merging neighbours that keep their distance
+	auto matched = migration.Matched;
+	std::sort(matched.begin(), matched.end(), [&old](const auto& lhs, const auto& rhs) { return old.Fields[lhs.first].Offset < old.Fields[rhs.first].Offset; });
+	for (const auto& [i, j] : matched)
+	{
+		const auto& oldfield = old.Fields[i];
+		const auto& field = obj.Fields[j];
+		if (!isTriviallyCopyable(field.Meta.ValueType))
+		{
+			push(MigrationOp::Move, oldfield.Offset, field.Offset, (uint64_t)field.Meta.ValueType);
+			continue;
+		}
+
+		if (!program.empty())
+		{
+			auto& last = program.back();
+			if (last[0] == (uint64_t)MigrationOp::Copy && last[1] + last[3] == oldfield.Offset && last[2] + last[3] == field.Offset)
+			{
+				last[3] += field.Meta.Size;
+				continue;
+			}
+		}
+		push(MigrationOp::Copy, oldfield.Offset, field.Offset, field.Meta.Size);
+	}
+
+	for (const auto& [i, j] : migration.Changed)
+	{
+		const auto& oldfield = old.Fields[i];
+		const auto& field = obj.Fields[j];
+		push(MigrationOp::Convert, oldfield.Offset, field.Offset, ((uint64_t)oldfield.Meta.ValueType << 8) | (uint64_t)field.Meta.ValueType);
+	}
+
+	//New fields start with their default value
+	const DefaultImage image = BakeDefaults(obj);
+	for (const size_t j : migration.Added)
+	{
+		const auto& field = obj.Fields[j];
+		if (!isTriviallyCopyable(field.Meta.ValueType))
+		{
+			push(MigrationOp::Construct, field.Offset, j, 0);
+			continue;
+		}
+
+		const size_t location = image.Locate(field.Offset);
+		if (!program.empty())
+		{
+			auto& last = program.back();
+			if (last[0] == (uint64_t)MigrationOp::Fill && last[1] + last[2] == field.Offset && last[3] + last[2] == location)
+			{
+				last[2] += field.Meta.Size;
+				continue;
+			}
+		}
+		push(MigrationOp::Fill, field.Offset, field.Meta.Size, location);
+	}
+
+	for (const size_t i : migration.Removed)
+	{
+		const auto& oldfield = old.Fields[i];
+		if (!isTriviallyCopyable(oldfield.Meta.ValueType))
+			push(MigrationOp::Destroy, oldfield.Offset, (uint64_t)oldfield.Meta.ValueType, 0);
+	}
+
+	return migration;
+}
+
+[[nodiscard]] bool is_numeric(FieldType type) noexcept
+{
+	switch (type)
+	{
+	case FieldType::Bool:
+	case FieldType::Char:
+	case FieldType::Byte:
+	case FieldType::Int16:
+	case FieldType::Int32:
+	case FieldType::Int64:
+	case FieldType::Uint16:
+	case FieldType::Uint32:
+	case FieldType::Uint64:
+	case FieldType::Float32:
+	case FieldType::Float64:
+	case FieldType::Enum_Char:
+	case FieldType::Enum_Byte:
+	case FieldType::Enum_Int16:
+	case FieldType::Enum_Int32:
+	case FieldType::Enum_Int64:
+	case FieldType::Enum_Uint16:
+	case FieldType::Enum_Uint32:
+	case FieldType::Enum_Uint64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+[[nodiscard]] bool is_vector(FieldType type) noexcept
+{
+	return type == FieldType::Vec2 || type == FieldType::Vec3 || type == FieldType::Vec4;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "reflect.h"
+
+#include <array>
+
+/**
+* @brief Operations of a migration program
+* @details Every instruction is four numbers: the operation followed by its operands.
+*	Offsets starting with "src" refer to the old instance and "dst" to the new one, which must be a separate buffer:
+*	fields that are reordered or change their size make the ranges of copies and conversions overlap.
+*/
+enum class MigrationOp : unsigned char {
+	Copy = 0,//src, dst, size: Bytes copied as they are
+	Convert,//src, dst, (old type << 8) | new type: Numeric value converted between types
+	Move,//src, dst, type: String, Asset or Entity that must be moved
+	Fill,//dst, size, image: Bytes copied from offset image of the new default image
+	Construct,//dst, field, 0: Non trivially copyable field initialized from its default
+	Destroy,//src, type, 0: String, Asset or Entity that no longer exists
+};
+
+using MigrationInstruction = std::array<uint64_t, 4>;
+
+/**
+* @brief Field-level difference between the old version of an object and the new one
+* @details Indices refer to the position of the field on the Fields of each object.
+*	Fields are matched by their name on the editor.
+*/
+struct Migration {
+	uint64_t From = 0;
+	std::vector<std::pair<size_t, size_t>> Matched;
+	std::vector<std::pair<size_t, size_t>> Changed;//Matched but their type changed
+	std::vector<size_t> Added;
+	std::vector<size_t> Removed;
+	std::vector<MigrationInstruction> Program;
+};
+
+/**
+* @brief Computes the difference between two versions of an object and the program that migrates
+*	instances from the old layout to a new instance with the new one in a single pass
+*/
+[[nodiscard]] Migration Diff(const Object& old, const Object& obj) noexcept;
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+* @brief Settings for a single run of gtreflect as given on the command line
+*/
+struct Options {
+	bool IsPrebuild = true;
+	std::string Dir;
+
+	/**
+	* @brief Projects that BatchRun() reflects with the same settings, Dir is ignored
+	* @details Set with more than one -dir= or with -projects= (a file with one directory per line),
+	*	-jobs= limits how many of them run at the same time and defaults to the hardware threads
+	*/
+	std::vector<std::string> Batch;
+	unsigned Jobs = 0;
+
+	/**
+	* @brief Export a single registry table instead of one function per object
+	* @details Enabled with -registry on the prebuild step
+	*/
+	bool Registry = false;
+
+	/**
+	* @brief Where the Engine listens for notifications and how long to wait on each step
+	* @details Set with -endpoint= and -timeout= (in milliseconds), an empty endpoint disables notifications
+	*/
+	std::string Endpoint;
+	std::chrono::milliseconds Timeout{ 2000 };
+
+	/**
+	* @brief Publish the model on shared memory so the Engine can map it instead of parsing the assets
+	* @details Enabled with -publish on the postbuild step
+	*/
+	bool Publish = false;
+
+	/**
+	* @brief Write every object, field, enum and default on .gt/reflection.gtdb
+	* @details Enabled with -db on the postbuild step, it has the same layout as the published model
+	*/
+	bool Database = false;
+
+	/**
+	* @brief Print padding, cache-line straddling and reordered size of every component
+	* @details Enabled with -layout on the prebuild step, the report is also written on .gt/layout.report
+	*/
+	bool LayoutReport = false;
+
+	/**
+	* @brief Warn about allocations on the update-style member functions of scripts and systems
+	* @details Enabled with -lint on the prebuild step, the warnings are also written on .gt/lint.json
+	*/
+	bool Lint = false;
+
+	/**
+	* @brief Triples of the targets whose layouts are computed besides the host's
+	* @details Set with -targets= (separated by commas) on the postbuild step, layouts are stored side by side on the assets
+	*/
+	std::vector<std::string> Targets;
+
+	/**
+	* @brief Skip parsing when the project is up to date on the reflection cache (.gt/cache)
+	* @details Disabled with -nocache, the cache is never used when the files aren't written or the model is published
+	*/
+	bool Cache = true;
+
+	/**
+	* @brief Write the generated files on disk, otherwise they are only returned to the caller
+	* @details Always enabled on the command line, in-process users may keep everything in memory
+	*/
+	bool WriteFiles = true;
+};
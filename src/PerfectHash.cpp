@@ -0,0 +1,140 @@
+#include "PerfectHash.h"
+#include "reflect.h"
+
+#include <algorithm>
+#include <numeric>
+
+//Upper bound for the seeds that we try per bucket before giving up
+static constexpr uint32_t sMaxSeed = 1 << 24;
+
+[[nodiscard]] uint32_t PerfectHash::Hash(const std::string& key, uint32_t seed) noexcept
+{
+	//FNV-1a followed by murmur's finalizer, must match the one on WriteSource()
+	uint32_t hash = 0x811C9DC5u ^ seed;
+	for (const char c : key)
+	{
+		hash ^= (uint8_t)c;
+		hash *= 0x01000193u;
+	}
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35u;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+[[nodiscard]] PerfectHash PerfectHash::Build(const std::vector<std::string>& keys) noexcept
+{
+	PerfectHash table;
+	const uint32_t size = (uint32_t)keys.size();
+	if (size == 0)
+		return table;
+
+	table.Seeds.resize(size, 0);
+	table.Slots.resize(size, 0);
+
+	//Distribute keys into buckets
+	std::vector<std::vector<uint32_t>> buckets(size);
+	for (uint32_t i = 0; i < size; i++)
+		buckets[Hash(keys[i], 0) % size].push_back(i);
+
+	//Place biggest buckets first while there are still many free slots
+	std::vector<uint32_t> order(size);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&buckets](uint32_t lhs, uint32_t rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+	std::vector<bool> taken(size, false);
+	std::vector<uint32_t> slots;
+	for (const uint32_t b : order)
+	{
+		const auto& bucket = buckets[b];
+		if (bucket.empty())
+			break;
+
+		bool placed = false;
+		for (uint32_t seed = 1; seed < sMaxSeed && !placed; seed++)
+		{
+			slots.clear();
+			placed = true;
+			for (const uint32_t key : bucket)
+			{
+				const uint32_t slot = Hash(keys[key], seed) % size;
+				if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end())
+				{
+					placed = false;
+					break;
+				}
+				slots.push_back(slot);
+			}
+
+			if (!placed)
+				continue;
+
+			table.Seeds[b] = seed;
+			for (size_t i = 0; i < bucket.size(); i++)
+			{
+				taken[slots[i]] = true;
+				table.Slots[slots[i]] = bucket[i];
+			}
+		}
+		GTR_ASSERT_OR(placed, PerfectHash(), "Couldn't build perfect hash, check for duplicate name: %s\n", keys[bucket.front()].c_str());
+	}
+	return table;
+}
+
+[[nodiscard]] uint32_t PerfectHash::Find(const std::string& key) const noexcept
+{
+	const uint32_t size = Size();
+	if (size == 0)
+		return UINT32_MAX;
+	const uint32_t seed = Seeds[Hash(key, 0) % size];
+	return Slots[Hash(key, seed) % size];
+}
+
+void PerfectHash::WriteSource(std::ostream& os) noexcept
+{
+	os << "#ifndef GTR_PERFECT_HASH\n"
+		"#define GTR_PERFECT_HASH\n"
+		"#include <cstdint>\n"
+		"#include <string_view>\n\n"
+		"namespace gtr {\n\n"
+		"\t[[nodiscard]] constexpr uint32_t Hash(std::string_view key, uint32_t seed) noexcept\n"
+		"\t{\n"
+		"\t\tuint32_t hash = 0x811C9DC5u ^ seed;\n"
+		"\t\tfor (const char c : key)\n"
+		"\t\t{\n"
+		"\t\t\thash ^= (uint8_t)c;\n"
+		"\t\t\thash *= 0x01000193u;\n"
+		"\t\t}\n"
+		"\t\thash ^= hash >> 16;\n"
+		"\t\thash *= 0x85EBCA6Bu;\n"
+		"\t\thash ^= hash >> 13;\n"
+		"\t\thash *= 0xC2B2AE35u;\n"
+		"\t\thash ^= hash >> 16;\n"
+		"\t\treturn hash;\n"
+		"\t}\n\n"
+		"\t//Returns the candidate index for the key (names must still be compared) or UINT32_MAX on empty tables\n"
+		"\t[[nodiscard]] constexpr uint32_t Lookup(const uint32_t* seeds, const uint32_t* slots, uint32_t size, std::string_view key) noexcept\n"
+		"\t{\n"
+		"\t\tif (size == 0) return UINT32_MAX;\n"
+		"\t\treturn slots[Hash(key, seeds[Hash(key, 0) % size]) % size];\n"
+		"\t}\n\n"
+		"}\n"
+		"#endif\n\n";
+}
+
+void PerfectHash::WriteTables(std::ostream& os, const std::string& prefix) const noexcept
+{
+	auto write = [&os](const char* name, const std::string& prefix, const std::vector<uint32_t>& values)
+	{
+		os << "\tconstexpr uint32_t " << prefix << name << "[] = { ";
+		if (values.empty())
+			os << 0;
+		for (size_t i = 0; i < values.size(); i++)
+			os << (i == 0 ? "" : ", ") << values[i];
+		os << " };\n";
+	};
+	write("Seeds", prefix, Seeds);
+	write("Slots", prefix, Slots);
+}
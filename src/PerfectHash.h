@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+* @brief Minimal perfect hash over a fixed set of names
+* @details Built using "hash and displace": a name picks its bucket by hashing with seed 0,
+*	and its slot by hashing with the seed stored for that bucket. Every slot holds the index
+*	of the name in the list that was used to build the table.
+*/
+struct PerfectHash {
+	std::vector<uint32_t> Seeds;
+	std::vector<uint32_t> Slots;
+
+	[[nodiscard]] uint32_t Size(void) const noexcept { return (uint32_t)Slots.size(); }
+
+	/**
+	* @brief Finds the index of the given name
+	* @return The index that the name had while building, or the index of some other name
+	*	if the given one wasn't part of the set (Caller must compare names)
+	*/
+	[[nodiscard]] uint32_t Find(const std::string& key) const noexcept;
+
+	/**
+	* @brief Builds a perfect hash for the given names
+	* @details Names must be unique
+	*/
+	[[nodiscard]] static PerfectHash Build(const std::vector<std::string>& keys) noexcept;
+
+	[[nodiscard]] static uint32_t Hash(const std::string& key, uint32_t seed) noexcept;
+
+	/**
+	* @brief Writes the lookup helpers for generated code
+	* @details Output is guarded so it can be written in more than one generated header
+	*/
+	static void WriteSource(std::ostream& os) noexcept;
+
+	/**
+	* @brief Writes the Seeds & Slots of the table as two constexpr arrays
+	*/
+	void WriteTables(std::ostream& os, const std::string& prefix) const noexcept;
+};
@@ -0,0 +1,250 @@
+#include "ReflectionCache.h"
+#include "reflect.h"
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#pragma warning(push)
+#pragma warning(disable: 4267 4244)
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/Process.h>
+#pragma warning(pop)
+
+[[nodiscard]] static bool read_file(const std::filesystem::path& filepath, std::string& content) noexcept
+{
+	std::ifstream is(filepath, std::ios::binary);
+	if (!is.is_open())
+		return false;
+	std::ostringstream ss;
+	ss << is.rdbuf();
+	content = ss.str();
+	return true;
+}
+
+//Readers (and other configurations) see either the old or the new file
+static bool write_file(const std::filesystem::path& filepath, std::string_view content) noexcept
+{
+	auto temporary = filepath;
+	temporary += ".tmp";
+	std::ofstream os(temporary, std::ios::binary);
+	os.write(content.data(), content.size());
+	os.close();
+
+	std::error_code error;
+	if (os.good())
+		std::filesystem::rename(temporary, filepath, error);
+	if (!os.good() || error)
+	{
+		std::filesystem::remove(temporary, error);
+		return false;
+	}
+	return true;
+}
+
+ProjectLock::ProjectLock(const std::filesystem::path& filepath) noexcept
+{
+	if (llvm::sys::fs::openFileForReadWrite(filepath.string(), mFile, llvm::sys::fs::CD_OpenAlways, llvm::sys::fs::OF_None))
+	{
+		mFile = -1;
+		return;
+	}
+	if (llvm::sys::fs::lockFile(mFile))
+		Release();
+}
+
+ProjectLock& ProjectLock::operator=(ProjectLock&& other) noexcept
+{
+	if (this != &other)
+	{
+		Release();
+		mFile = std::exchange(other.mFile, -1);
+	}
+	return *this;
+}
+
+ProjectLock::~ProjectLock(void) { Release(); }
+
+void ProjectLock::Release(void) noexcept
+{
+	if (mFile == -1)
+		return;
+	(void)llvm::sys::fs::unlockFile(mFile);
+	(void)llvm::sys::Process::SafelyCloseFileDescriptor(mFile);
+	mFile = -1;
+}
+
+ReflectionCache::ReflectionCache(const std::filesystem::path& dir) noexcept
+	: mProjectDir(dir), mDir(dir / ".gt/cache") {}
+
+[[nodiscard]] ProjectLock ReflectionCache::Lock(void) const noexcept
+{
+	std::error_code error;
+	std::filesystem::create_directories(mDir / "objects", error);
+	ProjectLock lock(mDir / "lock");
+	if (!lock.Locked())
+		gtr::LogError("Couldn't lock %s, reflection cache is disabled\n", (mDir / "lock").string().c_str());
+	return lock;
+}
+
+[[nodiscard]] std::string ReflectionCache::Key(const std::string& inputs, const std::vector<std::filesystem::path>& state) const noexcept
+{
+	std::vector<std::filesystem::path> sorted = state;
+	std::sort(sorted.begin(), sorted.end());
+
+	llvm::MD5 md5;
+	md5.update(inputs);
+	std::string content;
+	for (const auto& filepath : sorted)
+	{
+		if (!read_file(filepath, content))
+			continue;
+		md5.update(std::filesystem::relative(filepath, mProjectDir).generic_string());
+		md5.update(Hash(content));
+	}
+	llvm::MD5::MD5Result result;
+	md5.final(result);
+	return std::string(result.digest());
+}
+
+[[nodiscard]] bool ReflectionCache::Restore(const std::string& key) const noexcept
+{
+	const auto entrypath = mDir / (key + ".entry");
+	if (!std::filesystem::exists(entrypath))
+		return false;
+
+	YAML::Node data;
+	try { data = YAML::LoadFile(entrypath.string()); }
+	catch (YAML::Exception e) { return false; }//Treated as a miss, it'll be overwritten
+
+	std::string content;
+	for (const auto& node : data["Dependencies"])
+	{
+		const auto filepath = node["Path"].as<std::string>();
+		if (!read_file(filepath, content) || Hash(content).compare(node["Hash"].as<std::string>()) != 0)
+		{
+			gtr::Log("Reflection cache: %s changed\n", filepath.c_str());
+			return false;
+		}
+	}
+
+	//Every output must be available before anything is touched
+	std::vector<std::pair<std::filesystem::path, std::string>> outputs;
+	for (const auto& node : data["Outputs"])
+	{
+		const auto hash = node["Hash"].as<std::string>();
+		if (!std::filesystem::exists(mDir / "objects" / hash))
+			return false;
+		outputs.emplace_back(mProjectDir / node["Path"].as<std::string>(), hash);
+	}
+
+	for (const auto& [filepath, hash] : outputs)
+	{
+		if (read_file(filepath, content) && Hash(content).compare(hash) == 0)
+			continue;
+		gtr::Log("Reflection cache: restoring %s\n", std::filesystem::relative(filepath, mProjectDir).string().c_str());
+		if (!read_file(mDir / "objects" / hash, content) || !write_file(filepath, content))
+			gtr::LogError("Couldn't restore %s\n", filepath.string().c_str());
+	}
+	std::error_code error;
+	for (const auto& node : data["Removed"])
+		std::filesystem::remove(mProjectDir / node.as<std::string>(), error);
+
+	//Recently used entries survive pruning
+	std::filesystem::last_write_time(entrypath, std::filesystem::file_time_type::clock::now(), error);
+	return true;
+}
+
+void ReflectionCache::Store(const std::string& key, const std::vector<std::string>& dependencies, const std::vector<std::filesystem::path>& outputs, const std::vector<std::filesystem::path>& removed) const noexcept
+{
+	std::string content;
+	YAML::Emitter out;
+	out << YAML::BeginMap;
+	out << YAML::Key << "Dependencies" << YAML::Value << YAML::BeginSeq;
+	for (const auto& filepath : dependencies)
+	{
+		if (!read_file(filepath, content))
+			continue;
+		out << YAML::Flow << YAML::BeginMap;
+		out << YAML::Key << "Path" << YAML::Value << filepath;
+		out << YAML::Key << "Hash" << YAML::Value << Hash(content);
+		out << YAML::EndMap;
+	}
+	out << YAML::EndSeq;
+
+	out << YAML::Key << "Outputs" << YAML::Value << YAML::BeginSeq;
+	for (const auto& filepath : outputs)
+	{
+		if (!read_file(filepath, content))
+		{
+			gtr::LogError("Couldn't read %s for the reflection cache\n", filepath.string().c_str());
+			return;
+		}
+		const auto hash = Hash(content);
+		const auto object = mDir / "objects" / hash;
+		if (!std::filesystem::exists(object) && !write_file(object, content))
+		{
+			gtr::LogError("Couldn't write on the reflection cache: %s\n", object.string().c_str());
+			return;
+		}
+		out << YAML::Flow << YAML::BeginMap;
+		out << YAML::Key << "Path" << YAML::Value << std::filesystem::relative(filepath, mProjectDir).generic_string();
+		out << YAML::Key << "Hash" << YAML::Value << hash;
+		out << YAML::EndMap;
+	}
+	out << YAML::EndSeq;
+
+	out << YAML::Key << "Removed" << YAML::Value << YAML::BeginSeq;
+	for (const auto& filepath : removed)
+		out << std::filesystem::relative(filepath, mProjectDir).generic_string();
+	out << YAML::EndSeq;
+	out << YAML::EndMap;
+
+	write_file(mDir / (key + ".entry"), out.c_str());
+	Prune();
+}
+
+[[nodiscard]] std::string ReflectionCache::Hash(std::string_view data) noexcept
+{
+	llvm::MD5 md5;
+	md5.update(llvm::StringRef(data.data(), data.size()));
+	llvm::MD5::MD5Result result;
+	md5.final(result);
+	return std::string(result.digest());
+}
+
+void ReflectionCache::Prune(void) const noexcept
+{
+	std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> entries;
+	std::error_code error;
+	for (const auto& entry : std::filesystem::directory_iterator(mDir, error))
+	{
+		if (entry.path().extension().compare(".entry") == 0)
+			entries.emplace_back(entry.last_write_time(error), entry.path());
+	}
+
+	//Least recently used entries go first, then everything they alone referred to
+	std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+	for (size_t i = MaxEntries; i < entries.size(); i++)
+		std::filesystem::remove(entries[i].second, error);
+	entries.resize(std::min(entries.size(), MaxEntries));
+
+	std::set<std::string> referenced;
+	for (const auto& [time, filepath] : entries)
+	{
+		try
+		{
+			const YAML::Node data = YAML::LoadFile(filepath.string());
+			for (const auto& node : data["Outputs"])
+				referenced.insert(node["Hash"].as<std::string>());
+		}
+		catch (YAML::Exception e) { return; }//Unsure what is still needed
+	}
+	for (const auto& entry : std::filesystem::directory_iterator(mDir / "objects", error))
+	{
+		if (referenced.find(entry.path().filename().string()) == referenced.end())
+			std::filesystem::remove(entry.path(), error);
+	}
+}
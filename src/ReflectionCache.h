@@ -0,0 +1,76 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+* @brief Exclusive lock on a project that is shared by every gtreflect process, released when destroyed
+*/
+class ProjectLock {
+public:
+	ProjectLock(void) noexcept = default;
+	ProjectLock(const std::filesystem::path& filepath) noexcept;
+	ProjectLock(ProjectLock&& other) noexcept : mFile(std::exchange(other.mFile, -1)) {}
+	ProjectLock& operator=(ProjectLock&& other) noexcept;
+	~ProjectLock(void);
+
+	ProjectLock(const ProjectLock&) = delete;
+	ProjectLock& operator=(const ProjectLock&) = delete;
+
+	[[nodiscard]] bool Locked(void) const noexcept { return mFile != -1; }
+
+private:
+	void Release(void) noexcept;
+	int mFile = -1;
+};
+
+/**
+* @brief Results of earlier runs of reflection on a project, shared by every configuration that builds it
+* @details Lives on the project's .gt/cache. An entry is keyed by everything that a step reads: the caller hashes
+*	clangdump.hpp (which inlines every header of the project), the compile command (defines and target), the flags
+*	and the build of gtreflect, and the contents of the files that the step keeps (assets & caches) are added here.
+*	Entries are stored for the state that a run leaves the project at, so the next configuration that runs the same
+*	step on the same sources finds it up to date. Headers that clang read from disk are recorded with their hash and
+*	have to be unchanged for a hit. Contents of the outputs are stored once, named after their hash.
+*/
+class ReflectionCache {
+public:
+	ReflectionCache(const std::filesystem::path& dir) noexcept;
+
+	/**
+	* @brief Waits until no other process works on the project, files shouldn't be read or written before
+	*/
+	[[nodiscard]] ProjectLock Lock(void) const noexcept;
+
+	/**
+	* @param inputs Already hashed inputs of the step
+	* @param state Files that the step reads and writes, the ones that are missing are skipped
+	*/
+	[[nodiscard]] std::string Key(const std::string& inputs, const std::vector<std::filesystem::path>& state) const noexcept;
+
+	/**
+	* @brief Brings the outputs on disk to what is stored for the key
+	* @return Whether there was a valid entry, nothing is written otherwise
+	*/
+	[[nodiscard]] bool Restore(const std::string& key) const noexcept;
+
+	/**
+	* @param dependencies Absolute paths of the headers that clang read
+	* @param outputs Files that the step wrote, they are read from disk
+	* @param removed Files that the step deleted
+	*/
+	void Store(const std::string& key, const std::vector<std::string>& dependencies, const std::vector<std::filesystem::path>& outputs, const std::vector<std::filesystem::path>& removed) const noexcept;
+
+	[[nodiscard]] static std::string Hash(std::string_view data) noexcept;
+
+	static constexpr size_t MaxEntries = 64;
+
+private:
+	void Prune(void) const noexcept;
+
+	std::filesystem::path mProjectDir;
+	std::filesystem::path mDir;
+};
@@ -0,0 +1,332 @@
+#include "SharedModel.h"
+#include "FlatModel.h"
+#include "Layout.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <new>
+#include <unordered_map>
+
+#ifdef _WIN32
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+/**
+* @brief Deduplicated, null terminated strings of the model
+*/
+class StringTable {
+public:
+
+	[[nodiscard]] gtr::flat::String Add(const std::string& str) noexcept
+	{
+		const auto it = mOffsets.find(str);
+		if (it != mOffsets.end())
+			return { it->second, (uint32_t)str.size() };
+
+		const uint32_t offset = (uint32_t)mData.size();
+		mData.insert(mData.end(), str.begin(), str.end());
+		mData.push_back('\0');
+		mOffsets.insert({ str, offset });
+		return { offset, (uint32_t)str.size() };
+	}
+
+	[[nodiscard]] const std::vector<char>& Data(void) const noexcept { return mData; }
+
+private:
+	std::vector<char> mData;
+	std::unordered_map<std::string, uint32_t> mOffsets;
+};
+
+template<typename T>
+static void append(std::vector<uint8_t>& buffer, const std::vector<T>& items, uint64_t& offset) noexcept
+{
+	buffer.resize((buffer.size() + 7) & ~(size_t)7);//Every array starts aligned
+	offset = buffer.size();
+	buffer.resize(buffer.size() + items.size() * sizeof(T));
+	if (!items.empty())
+		memcpy(buffer.data() + offset, items.data(), items.size() * sizeof(T));
+}
+
+[[nodiscard]] std::vector<uint8_t> FlattenModel(const std::unordered_map<std::string, Object>& objects, const std::unordered_map<std::string, Enum>& enums, uint64_t generation) noexcept
+{
+	std::vector<const Object*> sortedObjects;
+	for (const auto& [name, obj] : objects)
+	{
+		if (!obj.Meta.Name.empty())
+			sortedObjects.push_back(&obj);
+	}
+	std::sort(sortedObjects.begin(), sortedObjects.end(), [](const Object* lhs, const Object* rhs) { return lhs->Meta.Name < rhs->Meta.Name; });
+
+	std::vector<const Enum*> sortedEnums;
+	for (const auto& [name, enm] : enums)
+		sortedEnums.push_back(&enm);
+	std::sort(sortedEnums.begin(), sortedEnums.end(), [](const Enum* lhs, const Enum* rhs) { return lhs->Meta.Name < rhs->Meta.Name; });
+
+	StringTable strings;
+	std::vector<gtr::flat::Object> flatObjects;
+	std::vector<gtr::flat::Field> flatFields;
+	std::vector<gtr::flat::Range> flatRanges;
+	std::vector<uint32_t> flatFixups;
+	std::vector<uint8_t> images;
+	for (const Object* obj : sortedObjects)
+	{
+		const DefaultImage image = BakeDefaults(*obj);
+
+		gtr::flat::Object flat;
+		flat.Name = strings.Add(obj->Meta.Name);
+		flat.CppName = strings.Add(obj->Name);
+		flat.Header = strings.Add(obj->Header);
+		flat.Id = strings.Add(obj->Id);
+		flat.Size = obj->Meta.Size;
+		flat.Version = obj->Version;
+		flat.Type = (uint32_t)obj->Meta.Type;
+		flat.TypeId = obj->TypeId;
+		flat.FirstField = (uint32_t)flatFields.size();
+		flat.FieldCount = (uint32_t)obj->Fields.size();
+		flat.FirstRange = (uint32_t)flatRanges.size();
+		flat.RangeCount = (uint32_t)image.Ranges.size();
+		flat.FirstFixup = (uint32_t)flatFixups.size();
+		flat.FixupCount = (uint32_t)image.Fixups.size();
+		flat.Image = images.size();
+		flat.ImageSize = image.Bytes.size();
+		flat.Instances = obj->Storage.Instances;
+		flat.Chunk = obj->Storage.Chunk;
+		flat.Align = obj->Storage.Align;
+		flat.Storage = (uint32_t)obj->Storage.Kind;
+		flatObjects.push_back(flat);
+
+		for (const auto& range : image.Ranges)
+			flatRanges.push_back({ range.Offset, range.Size });
+		for (size_t fixup : image.Fixups)
+			flatFixups.push_back((uint32_t)fixup);
+		images.insert(images.end(), image.Bytes.begin(), image.Bytes.end());
+
+		for (const auto& field : obj->Fields)
+		{
+			gtr::flat::Field flatField;
+			flatField.Name = strings.Add(field.Meta.Name);
+			flatField.CppName = strings.Add(field.Name);
+			flatField.TypeName = strings.Add(field.TypeName);
+			if (field.Meta.ValueType == FieldType::String && field.Default["Default"])
+				flatField.Default = strings.Add(field.Default["Default"].as<std::string>());
+			flatField.Offset = field.Offset;
+			flatField.Size = field.Meta.Size;
+			flatField.Type = (uint32_t)field.Meta.ValueType;
+			flatField.Min = field.Meta.MinUint;
+			flatField.Max = field.Meta.MaxUint;
+			flatFields.push_back(flatField);
+		}
+	}
+
+	std::vector<gtr::flat::Enum> flatEnums;
+	std::vector<gtr::flat::EnumValue> flatValues;
+	for (const Enum* enm : sortedEnums)
+	{
+		gtr::flat::Enum flat;
+		flat.Name = strings.Add(enm->Meta.Name);
+		flat.CppName = strings.Add(enm->Name);
+		flat.Size = enm->Meta.Size;
+		flat.Type = (uint32_t)enm->Type;
+		flat.FirstValue = (uint32_t)flatValues.size();
+		flat.ValueCount = (uint32_t)enm->Values.size();
+		flatEnums.push_back(flat);
+
+		for (const auto& [name, value] : enm->Values)
+			flatValues.push_back({ strings.Add(name), value.Uvalue });
+	}
+
+	//uuids are looked up by the Engine far more often than names
+	std::vector<uint32_t> ids(flatObjects.size());
+	for (uint32_t i = 0; i < (uint32_t)ids.size(); i++)
+		ids[i] = i;
+	std::sort(ids.begin(), ids.end(), [&sortedObjects](uint32_t lhs, uint32_t rhs) { return sortedObjects[lhs]->Id < sortedObjects[rhs]->Id; });
+
+	gtr::flat::Header header;
+	header.Generation = generation;
+	header.ObjectCount = (uint32_t)flatObjects.size();
+	header.FieldCount = (uint32_t)flatFields.size();
+	header.EnumCount = (uint32_t)flatEnums.size();
+	header.ValueCount = (uint32_t)flatValues.size();
+	header.RangeCount = (uint32_t)flatRanges.size();
+	header.FixupCount = (uint32_t)flatFixups.size();
+
+	std::vector<uint8_t> buffer(sizeof(gtr::flat::Header));
+	append(buffer, flatObjects, header.Objects);
+	append(buffer, flatFields, header.Fields);
+	append(buffer, flatEnums, header.Enums);
+	append(buffer, flatValues, header.Values);
+	append(buffer, flatRanges, header.Ranges);
+	append(buffer, flatFixups, header.Fixups);
+	append(buffer, ids, header.Ids);
+	append(buffer, images, header.Images);
+	header.ImagesSize = images.size();
+	append(buffer, strings.Data(), header.Strings);
+	header.StringsSize = strings.Data().size();
+	header.Size = buffer.size();
+	memcpy(buffer.data(), &header, sizeof(header));
+	return buffer;
+}
+
+[[nodiscard]] std::string SharedModelName(const std::filesystem::path& dir) noexcept
+{
+	auto project = (dir.has_filename() ? dir : dir.parent_path()).filename().string();
+	std::replace_if(project.begin(), project.end(), [](char c) { return !isalnum((unsigned char)c); }, '_');
+	return "GreenTeaReflection." + project;
+}
+
+/**
+* @brief Writable view of a named segment
+*/
+class Segment {
+public:
+	~Segment(void) { Close(); }
+
+	[[nodiscard]] bool Open(const std::string& name, const std::filesystem::path& dir, size_t size, bool exclusive) noexcept;
+	void Close(void) noexcept;
+	static void Unlink(const std::string& name, const std::filesystem::path& dir) noexcept;
+
+	[[nodiscard]] void* Data(void) noexcept { return mData; }
+	[[nodiscard]] bool Created(void) const noexcept { return mCreated; }
+
+private:
+	void* mData = nullptr;
+	size_t mSize = 0;
+	bool mCreated = false;
+#ifdef _WIN32
+	void* mFile = nullptr;
+	void* mMapping = nullptr;
+#endif
+};
+
+#ifdef _WIN32
+
+[[nodiscard]] bool Segment::Open(const std::string& name, const std::filesystem::path& dir, size_t size, bool exclusive) noexcept
+{
+	const auto filepath = (dir / name).string();
+	HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+		exclusive ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	mFile = file;
+	mCreated = exclusive || GetLastError() != ERROR_ALREADY_EXISTS;
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32), (DWORD)size, nullptr);
+	if (!mapping)
+		return false;
+	mMapping = mapping;
+	mData = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+	mSize = size;
+	return mData != nullptr;
+}
+
+void Segment::Close(void) noexcept
+{
+	if (mData)
+		UnmapViewOfFile(mData);
+	if (mMapping)
+		CloseHandle(mMapping);
+	if (mFile)
+		CloseHandle(mFile);
+	mData = nullptr;
+	mMapping = nullptr;
+	mFile = nullptr;
+}
+
+void Segment::Unlink(const std::string& name, const std::filesystem::path& dir) noexcept
+{
+	DeleteFileA((dir / name).string().c_str());//Fails while the Engine still maps it, which is fine
+}
+
+#else
+
+[[nodiscard]] bool Segment::Open(const std::string& name, const std::filesystem::path& dir, size_t size, bool exclusive) noexcept
+{
+	(void)dir;//Shared memory objects have their own namespace
+	const auto shmname = "/" + name;
+	int fd = -1;
+	if (exclusive)
+	{
+		shm_unlink(shmname.c_str());//Left behind by a run that didn't finish
+		fd = shm_open(shmname.c_str(), O_RDWR | O_CREAT | O_EXCL, 0444);//Read-only for everyone else
+		mCreated = true;
+	}
+	else
+	{
+		fd = shm_open(shmname.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+		mCreated = fd >= 0;
+		if (fd < 0 && errno == EEXIST)
+			fd = shm_open(shmname.c_str(), O_RDWR, 0644);
+	}
+	if (fd < 0)
+		return false;
+
+	if (mCreated && ftruncate(fd, (off_t)size) != 0)
+	{
+		close(fd);
+		return false;
+	}
+	void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);//Mapping stays valid
+	if (data == MAP_FAILED)
+		return false;
+	mData = data;
+	mSize = size;
+	return true;
+}
+
+void Segment::Close(void) noexcept
+{
+	if (mData)
+		munmap(mData, mSize);
+	mData = nullptr;
+}
+
+void Segment::Unlink(const std::string& name, const std::filesystem::path& dir) noexcept
+{
+	(void)dir;
+	shm_unlink(("/" + name).c_str());
+}
+
+#endif
+
+uint64_t PublishModel(const std::string& name, const std::filesystem::path& dir, std::vector<uint8_t>& model) noexcept
+{
+	Segment control;
+	if (!control.Open(name, dir, sizeof(gtr::flat::Control), false))
+	{
+		gtr::Log("Failed to open shared memory segment: %s\n", name.c_str());
+		return 0;
+	}
+
+	auto* ctrl = static_cast<gtr::flat::Control*>(control.Data());
+	if (control.Created() || ctrl->Magic != gtr::flat::ControlMagic || ctrl->Version != gtr::flat::FormatVersion)
+		new (ctrl) gtr::flat::Control();
+
+	const uint64_t previous = ctrl->Generation.load(std::memory_order_acquire);
+	const uint64_t generation = previous + 1;
+	reinterpret_cast<gtr::flat::Header*>(model.data())->Generation = generation;
+
+	const auto modelname = name + "." + std::to_string(generation);
+	Segment segment;
+	if (!segment.Open(modelname, dir, model.size(), true))
+	{
+		gtr::Log("Failed to create shared memory segment: %s\n", modelname.c_str());
+		return 0;
+	}
+	memcpy(segment.Data(), model.data(), model.size());
+	segment.Close();
+
+	//Readers that see the new generation also see the whole model
+	ctrl->Generation.store(generation, std::memory_order_release);
+	if (previous != 0)
+		Segment::Unlink(name + "." + std::to_string(previous), dir);
+	return generation;
+}
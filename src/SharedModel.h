@@ -0,0 +1,30 @@
+#pragma once
+
+#include "reflect.h"
+
+#include <filesystem>
+#include <unordered_map>
+
+/**
+* @brief Packs objects, enums and the default images of objects on the flat layout of FlatModel.h
+* @details Objects and enums are sorted by their name on the editor, so equal models produce equal buffers.
+*	Defaults are only available on postbuild.
+*/
+[[nodiscard]] std::vector<uint8_t> FlattenModel(const std::unordered_map<std::string, Object>& objects, const std::unordered_map<std::string, Enum>& enums, uint64_t generation) noexcept;
+
+/**
+* @brief Publishes a new generation of the model to a running Engine
+* @details The model is written on a read-only segment named after the control segment and the
+*	generation, then the control segment is pointed to it and the previous generation is unlinked.
+*	Readers that still map an older generation keep their view until they unmap it.
+*	On Windows named mappings die with their last handle, so segments are backed by files on dir.
+* @param name Name of the control segment
+* @param dir Directory of the project's .gt, only used on Windows
+* @returns Generation that was published, or 0 if publishing failed
+*/
+uint64_t PublishModel(const std::string& name, const std::filesystem::path& dir, std::vector<uint8_t>& model) noexcept;
+
+/**
+* @brief Name of the control segment for the project on the given directory
+*/
+[[nodiscard]] std::string SharedModelName(const std::filesystem::path& dir) noexcept;
@@ -0,0 +1,312 @@
+#include "Transport.h"
+#include "Log.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+
+	#ifndef MSG_NOSIGNAL
+		#define MSG_NOSIGNAL 0
+	#endif
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+[[nodiscard]] static int remaining(Clock::time_point deadline) noexcept
+{
+	const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+	return left > 0 ? (int)left : 0;
+}
+
+[[nodiscard]] std::unique_ptr<Transport> Transport::Create(const std::string& endpoint) noexcept
+{
+#ifdef _WIN32
+	return std::make_unique<NamedPipeTransport>(endpoint);
+#else
+	return std::make_unique<UnixSocketTransport>(endpoint);
+#endif
+}
+
+[[nodiscard]] std::string Transport::DefaultEndpoint(void) noexcept
+{
+#ifdef _WIN32
+	return "\\\\.\\pipe\\GreenTeaServer";
+#else
+	const char* dir = std::getenv("XDG_RUNTIME_DIR");
+	return std::string(dir ? dir : "/tmp") + "/GreenTeaServer.sock";
+#endif
+}
+
+#ifdef _WIN32
+
+[[nodiscard]] static TransportStatus wait_overlapped(HANDLE pipe, OVERLAPPED& overlapped, BOOL result, DWORD& bytes, std::chrono::milliseconds timeout) noexcept
+{
+	if (!result && GetLastError() != ERROR_IO_PENDING)
+		return TransportStatus::Failed;
+
+	if (WaitForSingleObject(overlapped.hEvent, (DWORD)timeout.count()) != WAIT_OBJECT_0)
+	{
+		CancelIo(pipe);
+		GetOverlappedResult(pipe, &overlapped, &bytes, TRUE);//Wait for the cancelation to finish
+		return TransportStatus::Timeout;
+	}
+	return GetOverlappedResult(pipe, &overlapped, &bytes, FALSE) ? TransportStatus::Ok : TransportStatus::Failed;
+}
+
+[[nodiscard]] TransportStatus NamedPipeTransport::Connect(std::chrono::milliseconds timeout) noexcept
+{
+	const auto deadline = Clock::now() + timeout;
+	while (true)
+	{
+		HANDLE pipe = CreateFileA(mPipename.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, nullptr);
+		if (pipe != INVALID_HANDLE_VALUE)
+		{
+			mPipe = pipe;
+			mEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+			return mEvent ? TransportStatus::Ok : TransportStatus::Failed;
+		}
+
+		const DWORD error = GetLastError();
+		if (error == ERROR_FILE_NOT_FOUND)
+			return TransportStatus::NotRunning;
+		else if (error != ERROR_PIPE_BUSY)
+			return TransportStatus::Failed;
+
+		//Every instance of the pipe is busy
+		const int left = remaining(deadline);
+		if (left == 0)
+			return TransportStatus::Timeout;
+		WaitNamedPipeA(mPipename.c_str(), (DWORD)left);
+	}
+}
+
+[[nodiscard]] TransportStatus NamedPipeTransport::Send(const std::string& msg, std::chrono::milliseconds timeout) noexcept
+{
+	OVERLAPPED overlapped = { 0 };
+	overlapped.hEvent = mEvent;
+	ResetEvent(mEvent);
+
+	DWORD bytes = 0;
+	BOOL result = WriteFile(mPipe, msg.c_str(), (DWORD)msg.size() + 1, nullptr, &overlapped);
+	return wait_overlapped(mPipe, overlapped, result, bytes, timeout);
+}
+
+[[nodiscard]] TransportStatus NamedPipeTransport::Receive(std::string& msg, std::chrono::milliseconds timeout) noexcept
+{
+	OVERLAPPED overlapped = { 0 };
+	overlapped.hEvent = mEvent;
+	ResetEvent(mEvent);
+
+	char buffer[1024];
+	DWORD bytes = 0;
+	BOOL result = ReadFile(mPipe, buffer, sizeof(buffer) - 1, nullptr, &overlapped);
+	const TransportStatus status = wait_overlapped(mPipe, overlapped, result, bytes, timeout);
+	if (status != TransportStatus::Ok)
+		return status;
+
+	buffer[bytes] = '\0';
+	msg = buffer;
+	return TransportStatus::Ok;
+}
+
+void NamedPipeTransport::Close(void) noexcept
+{
+	if (mPipe)
+		CloseHandle(mPipe);
+	if (mEvent)
+		CloseHandle(mEvent);
+	mPipe = nullptr;
+	mEvent = nullptr;
+}
+
+#else
+
+[[nodiscard]] TransportStatus UnixSocketTransport::Connect(std::chrono::milliseconds timeout) noexcept
+{
+	const auto deadline = Clock::now() + timeout;
+
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if (mPath.size() >= sizeof(address.sun_path))
+		return TransportStatus::Failed;
+	memcpy(address.sun_path, mPath.c_str(), mPath.size());
+
+	mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (mSocket < 0)
+		return TransportStatus::Failed;
+	fcntl(mSocket, F_SETFL, fcntl(mSocket, F_GETFL, 0) | O_NONBLOCK);
+
+	while (connect(mSocket, (const sockaddr*)&address, sizeof(address)) != 0)
+	{
+		if (errno == EINTR)
+			continue;
+		else if (errno == ENOENT || errno == ECONNREFUSED)
+		{
+			Close();
+			return TransportStatus::NotRunning;
+		}
+		else if (errno == EAGAIN)//Backlog of the server is full, try again
+		{
+			if (remaining(deadline) == 0)
+			{
+				Close();
+				return TransportStatus::Timeout;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			continue;
+		}
+		else if (errno != EINPROGRESS)
+		{
+			Close();
+			return TransportStatus::Failed;
+		}
+
+		pollfd pfd = { mSocket, POLLOUT, 0 };
+		if (poll(&pfd, 1, remaining(deadline)) <= 0)
+		{
+			Close();
+			return TransportStatus::Timeout;
+		}
+		int error = 0;
+		socklen_t length = sizeof(error);
+		getsockopt(mSocket, SOL_SOCKET, SO_ERROR, &error, &length);
+		if (error != 0)
+		{
+			Close();
+			return error == ECONNREFUSED ? TransportStatus::NotRunning : TransportStatus::Failed;
+		}
+		break;
+	}
+	return TransportStatus::Ok;
+}
+
+[[nodiscard]] TransportStatus UnixSocketTransport::Send(const std::string& msg, std::chrono::milliseconds timeout) noexcept
+{
+	const auto deadline = Clock::now() + timeout;
+	const char* data = msg.c_str();
+	const size_t size = msg.size() + 1;//Including the null terminator
+	size_t sent = 0;
+	while (sent < size)
+	{
+		pollfd pfd = { mSocket, POLLOUT, 0 };
+		const int ready = poll(&pfd, 1, remaining(deadline));
+		if (ready == 0)
+			return TransportStatus::Timeout;
+		else if (ready < 0 && errno != EINTR)
+			return TransportStatus::Failed;
+
+		const ssize_t bytes = send(mSocket, data + sent, size - sent, MSG_NOSIGNAL);
+		if (bytes < 0)
+		{
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+				continue;
+			return TransportStatus::Failed;
+		}
+		sent += (size_t)bytes;
+	}
+	return TransportStatus::Ok;
+}
+
+[[nodiscard]] TransportStatus UnixSocketTransport::Receive(std::string& msg, std::chrono::milliseconds timeout) noexcept
+{
+	const auto deadline = Clock::now() + timeout;
+	msg.clear();
+	char buffer[1024];
+	while (true)
+	{
+		pollfd pfd = { mSocket, POLLIN, 0 };
+		const int ready = poll(&pfd, 1, remaining(deadline));
+		if (ready == 0)
+			return TransportStatus::Timeout;
+		else if (ready < 0 && errno != EINTR)
+			return TransportStatus::Failed;
+
+		const ssize_t bytes = recv(mSocket, buffer, sizeof(buffer), 0);
+		if (bytes < 0)
+		{
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+				continue;
+			return TransportStatus::Failed;
+		}
+		else if (bytes == 0)//Server closed the connection
+			return msg.empty() ? TransportStatus::Failed : TransportStatus::Ok;
+
+		msg.append(buffer, (size_t)bytes);
+		const size_t end = msg.find('\0');
+		if (end != std::string::npos)
+		{
+			msg.resize(end);
+			return TransportStatus::Ok;
+		}
+	}
+}
+
+void UnixSocketTransport::Close(void) noexcept
+{
+	if (mSocket >= 0)
+		close(mSocket);
+	mSocket = -1;
+}
+
+#endif
+
+[[nodiscard]] TransportStatus Notify(const std::string& endpoint, const std::string& msg, std::chrono::milliseconds timeout) noexcept
+{
+	auto transport = Transport::Create(endpoint);
+	TransportStatus status = transport->Connect(timeout);
+	if (status != TransportStatus::Ok)
+		return status;
+
+	status = transport->Send(msg, timeout);
+	if (status != TransportStatus::Ok)
+		return status;
+
+	std::string answer;
+	status = transport->Receive(answer, timeout);
+	transport->Close();
+	if (status != TransportStatus::Ok)
+		return status;
+	return answer.compare("Ok") == 0 ? TransportStatus::Ok : TransportStatus::Failed;
+}
+
+void Notifier::Post(const std::string& msg) noexcept
+{
+	const auto endpoint = mEndpoint;
+	const auto timeout = mTimeout;
+	mPending.emplace_back(msg, std::async(std::launch::async, [endpoint, msg, timeout]() { return Notify(endpoint, msg, timeout); }));
+}
+
+void Notifier::Wait(void) noexcept
+{
+	for (auto& [msg, pending] : mPending)
+	{
+		switch (pending.get())
+		{
+		case TransportStatus::NotRunning:
+			gtr::Log("GreenTea engine is not running\n");
+			break;
+		case TransportStatus::Timeout:
+			gtr::Log("GreenTea engine didn't answer to %s in time\n", msg.c_str());
+			break;
+		case TransportStatus::Failed:
+			gtr::Log("Failed to notify GreenTea engine about %s\n", msg.c_str());
+			break;
+		default:
+			break;
+		}
+	}
+	mPending.clear();
+}
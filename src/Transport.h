@@ -0,0 +1,101 @@
+#pragma once
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+enum class TransportStatus {
+	Ok = 0,
+	NotRunning,//Nobody is listening on the endpoint
+	Timeout,
+	Failed,
+};
+
+/**
+* @brief Connection to the notification server of GreenTea Engine
+* @details Every operation takes a deadline, so a busy or hung editor can't stall the build.
+*	Messages are null terminated strings.
+*/
+class Transport {
+public:
+	virtual ~Transport(void) = default;
+
+	[[nodiscard]] virtual TransportStatus Connect(std::chrono::milliseconds timeout) noexcept = 0;
+	[[nodiscard]] virtual TransportStatus Send(const std::string& msg, std::chrono::milliseconds timeout) noexcept = 0;
+	[[nodiscard]] virtual TransportStatus Receive(std::string& msg, std::chrono::milliseconds timeout) noexcept = 0;
+	virtual void Close(void) noexcept = 0;
+
+	/**
+	* @brief Creates the transport of the current platform
+	* @details A named pipe on Windows and a Unix domain socket everywhere else
+	*/
+	[[nodiscard]] static std::unique_ptr<Transport> Create(const std::string& endpoint) noexcept;
+
+	/**
+	* @brief Endpoint that the Engine listens on by default
+	*/
+	[[nodiscard]] static std::string DefaultEndpoint(void) noexcept;
+};
+
+#ifdef _WIN32
+class NamedPipeTransport : public Transport {
+public:
+	NamedPipeTransport(const std::string& pipename) noexcept
+		: mPipename(pipename) {}
+	~NamedPipeTransport(void) { Close(); }
+
+	[[nodiscard]] TransportStatus Connect(std::chrono::milliseconds timeout) noexcept override;
+	[[nodiscard]] TransportStatus Send(const std::string& msg, std::chrono::milliseconds timeout) noexcept override;
+	[[nodiscard]] TransportStatus Receive(std::string& msg, std::chrono::milliseconds timeout) noexcept override;
+	void Close(void) noexcept override;
+
+private:
+	std::string mPipename;
+	void* mPipe = nullptr;
+	void* mEvent = nullptr;
+};
+#else
+class UnixSocketTransport : public Transport {
+public:
+	UnixSocketTransport(const std::string& path) noexcept
+		: mPath(path) {}
+	~UnixSocketTransport(void) { Close(); }
+
+	[[nodiscard]] TransportStatus Connect(std::chrono::milliseconds timeout) noexcept override;
+	[[nodiscard]] TransportStatus Send(const std::string& msg, std::chrono::milliseconds timeout) noexcept override;
+	[[nodiscard]] TransportStatus Receive(std::string& msg, std::chrono::milliseconds timeout) noexcept override;
+	void Close(void) noexcept override;
+
+private:
+	std::string mPath;
+	int mSocket = -1;
+};
+#endif
+
+/**
+* @brief Sends a message to the Engine and waits for its answer
+* @details Connecting, sending and receiving are each bounded by the given timeout
+*/
+[[nodiscard]] TransportStatus Notify(const std::string& endpoint, const std::string& msg, std::chrono::milliseconds timeout) noexcept;
+
+/**
+* @brief Fire-and-forget delivery of notifications
+* @details Post() returns immediately while the message is delivered on the background.
+*	Pending deliveries are waited upon destruction, which is bounded by the timeouts of Notify().
+*/
+class Notifier {
+public:
+	Notifier(const std::string& endpoint, std::chrono::milliseconds timeout) noexcept
+		: mEndpoint(endpoint), mTimeout(timeout) {}
+	~Notifier(void) { Wait(); }
+
+	void Post(const std::string& msg) noexcept;
+	void Wait(void) noexcept;
+
+private:
+	std::string mEndpoint;
+	std::chrono::milliseconds mTimeout;
+	std::vector<std::pair<std::string, std::future<TransportStatus>>> mPending;
+};
@@ -0,0 +1,123 @@
+#include "TypeIds.h"
+#include "Artifacts.h"
+
+#include <algorithm>
+#include <set>
+
+TypeIds::TypeIds(const std::filesystem::path& filepath) noexcept
+	: mFilepath(filepath)
+{
+	if (!std::filesystem::exists(mFilepath))
+		return;
+
+	YAML::Node data;
+	try { data = YAML::LoadFile(mFilepath.string()); }
+	catch (YAML::ParserException e) { GTR_ASSERT(false, "Failed to load file: typeids.cache\n\t%s\n", e.what()); }
+
+	for (const auto& node : data["Components"])
+		mIds.emplace(node["Name"].as<std::string>(), node["Id"].as<uint32_t>());
+	if (data["Build"])
+		mBuild = data["Build"].as<uint64_t>();
+	for (const auto& node : data["Retired"])
+		mRetired.emplace(node["Id"].as<uint32_t>(), node["Build"].as<uint64_t>());
+}
+
+void TypeIds::NextBuild(void) noexcept
+{
+	if (mRetired.empty())
+		return;
+
+	mBuild++;
+	mChanged = true;
+	for (auto it = mRetired.begin(); it != mRetired.end();)
+	{
+		if (mBuild > it->second + 1)
+			it = mRetired.erase(it);
+		else
+			++it;
+	}
+}
+
+void TypeIds::Assign(std::unordered_map<std::string, Object>& objects) noexcept
+{
+	//Forget components that no longer exist
+	std::set<std::string> names;
+	for (const auto& [rname, obj] : objects)
+	{
+		if (obj.Meta.Type == ReflectionType::Component && !obj.Meta.Name.empty())
+			names.insert(obj.Meta.Name);
+	}
+	for (auto it = mIds.begin(); it != mIds.end();)
+	{
+		if (names.find(it->first) == names.end())
+		{
+			mRetired[it->second] = mBuild;
+			it = mIds.erase(it);
+			mChanged = true;
+		}
+		else
+			++it;
+	}
+
+	//New components take the lowest free ids, retired ones aren't free yet
+	std::set<uint32_t> used;
+	for (const auto& [name, id] : mIds)
+		used.insert(id);
+	for (const auto& [id, build] : mRetired)
+		used.insert(id);
+	uint32_t next = 0;
+	for (const auto& name : names)
+	{
+		if (mIds.find(name) != mIds.end())
+			continue;
+		while (used.find(next) != used.end())
+			next++;
+		mIds.emplace(name, next);
+		used.insert(next);
+		mChanged = true;
+	}
+
+	for (auto& [rname, obj] : objects)
+	{
+		const auto it = mIds.find(obj.Meta.Name);
+		if (obj.Meta.Type == ReflectionType::Component && it != mIds.end())
+			obj.TypeId = it->second;
+	}
+}
+
+void TypeIds::Save(Artifacts& artifacts) const noexcept
+{
+	if (!mChanged && std::filesystem::exists(mFilepath))
+		return;
+
+	YAML::Emitter out;
+	const auto comment = "Auto Generated file by gtreflect.exe at " + Timestamp();
+	out << YAML::Comment(comment);
+	out << YAML::BeginMap;
+	out << YAML::Key << "Components" << YAML::Value << YAML::BeginSeq;
+	for (const auto& [name, id] : mIds)
+		out << YAML::BeginMap <<
+			YAML::Key << "Name" << YAML::Value << name <<
+			YAML::Key << "Id" << YAML::Value << id <<
+			YAML::EndMap;
+	out << YAML::EndSeq;
+	out << YAML::Key << "Build" << YAML::Value << mBuild;
+	out << YAML::Key << "Retired" << YAML::Value << YAML::BeginSeq;
+	for (const auto& [id, build] : mRetired)
+		out << YAML::BeginMap <<
+			YAML::Key << "Id" << YAML::Value << id <<
+			YAML::Key << "Build" << YAML::Value << build <<
+			YAML::EndMap;
+	out << YAML::EndSeq;
+	out << YAML::EndMap;
+
+	artifacts.Write(mFilepath) << out.c_str();
+}
+
+[[nodiscard]] uint32_t TypeIds::Count(void) const noexcept
+{
+	uint32_t count = 0;
+	for (const auto& [name, id] : mIds)
+		count = std::max(count, id + 1);
+	return count;
+}
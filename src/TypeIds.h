@@ -0,0 +1,53 @@
+#pragma once
+
+#include "reflect.h"
+#include "Artifacts.h"
+
+#include <filesystem>
+#include <map>
+#include <unordered_map>
+
+/**
+* @brief Dense ids for every reflected component
+* @details Assignments are persisted so a component keeps its id across builds and hot reloads.
+*	Ids of components that were removed are handed to new components, which keeps the ids dense
+*	enough to be used as indices on the Engine's signatures and storage arrays. A freed id is retired
+*	for the build after the one that freed it, so a hot reload never sees an id change its component.
+*/
+class TypeIds {
+public:
+
+	/**
+	* @brief Loads the assignments from the given cache if it exists
+	*/
+	TypeIds(const std::filesystem::path& filepath) noexcept;
+
+	/**
+	* @brief Starts a new build, called once per build before Assign()
+	* @details Only counted while there are retired ids, ids that were retired long enough become free
+	*/
+	void NextBuild(void) noexcept;
+
+	/**
+	* @brief Sets TypeId on every component of the given objects
+	* @details Components that already had an id keep it, new ones (in order of their name) get the lowest free id
+	*/
+	void Assign(std::unordered_map<std::string, Object>& objects) noexcept;
+
+	/**
+	* @brief Writes the cache back, only if assignments changed
+	*/
+	void Save(Artifacts& artifacts) const noexcept;
+
+	/**
+	* @brief Number of ids in use including holes
+	*/
+	[[nodiscard]] uint32_t Count(void) const noexcept;
+
+private:
+	std::filesystem::path mFilepath;
+	std::map<std::string, uint32_t> mIds;
+	std::map<uint32_t, uint64_t> mRetired;//Freed id and the build that freed it
+	uint64_t mBuild = 0;
+	bool mChanged = false;
+};
@@ -0,0 +1,633 @@
+#include "gtreflect.h"
+#include "FileCache.h"
+#include "Finders.h"
+#include "ReflectionCache.h"
+#include "SharedModel.h"
+#include "Transport.h"
+
+#pragma warning(push)
+#pragma warning(disable: 4267 4244)
+#include <clang/Frontend/FrontendActions.h>
+#include <clang/Frontend/ASTConsumers.h>
+#include <clang/Tooling/CompilationDatabase.h>
+#include <clang/Tooling/Tooling.h>
+#include <clang/AST/Type.h>
+#include <clang/Basic/FileManager.h>
+#include <clang/Frontend/CompilerInstance.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/VirtualFileSystem.h>
+#pragma warning(pop)
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+static constexpr const char* sClangFile = ".gt/clangdump.hpp";
+
+static void CreateClangFile(std::ostream& output, const std::filesystem::path& root) noexcept;
+
+struct DumpASTAction : public clang::ASTFrontendAction {
+	std::unique_ptr<clang::ASTConsumer>
+		CreateASTConsumer(clang::CompilerInstance& ci, clang::StringRef inFile) override
+	{
+		return clang::CreateASTDumper(
+			nullptr,//Dump to stdout
+			"",//No filter
+			true,//Dump decls
+			true,//Dump deserialize
+			false,//Don't dump lookups
+			true,//Dump decl types
+			clang::ASTDumpOutputFormat::ADOF_Default//format
+		);
+	}
+};
+
+/**
+* @brief Keeps the absolute paths of the files that are opened
+*/
+class RecordingFileSystem : public llvm::vfs::ProxyFileSystem {
+public:
+	RecordingFileSystem(llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> fs) noexcept
+		: ProxyFileSystem(std::move(fs)) {}
+
+	llvm::ErrorOr<std::unique_ptr<llvm::vfs::File>> openFileForRead(const llvm::Twine& path) override
+	{
+		auto file = ProxyFileSystem::openFileForRead(path);
+		if (file)
+		{
+			llvm::SmallString<256> absolute;
+			path.toVector(absolute);
+			makeAbsolute(absolute);
+			llvm::sys::path::remove_dots(absolute, true);
+			Opened.insert(std::string(absolute));
+		}
+		return file;
+	}
+
+	std::set<std::string> Opened;
+};
+
+/**
+* @brief Files seen by clang, shared by every parse of a run so headers are only read and stat'ed once
+* @details clangdump.hpp is handed to clang from memory. The working directory is the project's
+*	without changing the process' one, and with a cache the files on disk are read through it.
+*/
+class ToolFiles {
+public:
+	ToolFiles(const std::string& dir, const std::string& filepath, const std::string& clangfile, FileCache* cache) noexcept
+		: mPath(filepath)
+	{
+		llvm::IntrusiveRefCntPtr<llvm::vfs::FileSystem> disk = cache ? cache->View(dir) : llvm::vfs::createPhysicalFileSystem().release();
+		disk->setCurrentWorkingDirectory(dir);
+		mDisk = new RecordingFileSystem(disk);
+		mOverlay = new llvm::vfs::OverlayFileSystem(mDisk);
+		llvm::IntrusiveRefCntPtr<llvm::vfs::InMemoryFileSystem> memory(new llvm::vfs::InMemoryFileSystem);
+		memory->addFile(filepath, 0, llvm::MemoryBuffer::getMemBufferCopy(clangfile));
+		mOverlay->pushOverlay(memory);
+		mFiles = new clang::FileManager(clang::FileSystemOptions(), mOverlay);
+	}
+
+	[[nodiscard]] const std::string& Path(void) const noexcept { return mPath; }
+	[[nodiscard]] llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> FileSystem(void) const noexcept { return mOverlay; }
+	[[nodiscard]] llvm::IntrusiveRefCntPtr<clang::FileManager> Manager(void) const noexcept { return mFiles; }
+
+	//Headers that were read from disk by the parses so far, clangdump.hpp isn't one of them
+	[[nodiscard]] std::vector<std::string> Dependencies(void) const noexcept { return { mDisk->Opened.begin(), mDisk->Opened.end() }; }
+
+private:
+	std::string mPath;
+	llvm::IntrusiveRefCntPtr<RecordingFileSystem> mDisk;
+	llvm::IntrusiveRefCntPtr<llvm::vfs::OverlayFileSystem> mOverlay;
+	llvm::IntrusiveRefCntPtr<clang::FileManager> mFiles;
+};
+
+/**
+* @brief Parses without function bodies, which is all that laying out records needs
+*/
+class LayoutActionFactory : public clang::tooling::FrontendActionFactory {
+public:
+	LayoutActionFactory(clang::ast_matchers::MatchFinder& finder) noexcept
+		: mFinder(finder) {}
+
+	std::unique_ptr<clang::FrontendAction> create(void) override { return std::make_unique<Action>(mFinder); }
+
+private:
+	struct Action : public clang::ASTFrontendAction {
+		Action(clang::ast_matchers::MatchFinder& finder) noexcept
+			: Finder(finder) {}
+
+		std::unique_ptr<clang::ASTConsumer> CreateASTConsumer(clang::CompilerInstance& ci, clang::StringRef inFile) override { return Finder.newASTConsumer(); }
+		bool BeginInvocation(clang::CompilerInstance& ci) override
+		{
+			ci.getFrontendOpts().SkipFunctionBodies = true;
+			return true;
+		}
+
+		clang::ast_matchers::MatchFinder& Finder;
+	};
+
+	clang::ast_matchers::MatchFinder& mFinder;
+};
+
+/**
+* @brief Looks up the compilation database the same way as clang's tools do, falling back to no flags
+*/
+[[nodiscard]] static std::unique_ptr<clang::tooling::CompilationDatabase> compilation_database(const std::string& filepath) noexcept
+{
+	std::string error;
+	std::unique_ptr<clang::tooling::CompilationDatabase> compilations = clang::tooling::CompilationDatabase::autoDetectFromSource(filepath, error);
+	if (!compilations)
+		compilations = std::make_unique<clang::tooling::FixedCompilationDatabase>(".", std::vector<std::string>());
+	return compilations;
+}
+
+/**
+* @brief Runs the matchers on clangdump.hpp
+* @details With a target only records are matched, on a parse for that triple. Fails when clang does or when a
+*	GTR_ASSERT failed on a callback of a project on a batch.
+*/
+[[nodiscard]] static int run_tool(clang::ast_matchers::MatchFinder::MatchCallback& callback, const ToolFiles& files, const std::string& target = "") noexcept
+{
+	using namespace clang::ast_matchers;
+	using namespace clang::tooling;
+
+	const auto compilations = compilation_database(files.Path());
+	ClangTool tool(*compilations, { files.Path() }, std::make_shared<clang::PCHContainerOperations>(), files.FileSystem(), files.Manager());
+
+	MatchFinder finder;
+	DeclarationMatcher objectMatcher = cxxRecordDecl(decl().bind("id"), hasAttr(clang::attr::Annotate));
+	DeclarationMatcher fieldMatcher = fieldDecl(decl().bind("id"), hasAttr(clang::attr::Annotate));
+	DeclarationMatcher enumMatcher = enumDecl(decl().bind("id"), hasAttr(clang::attr::Annotate));
+
+	if (!target.empty())
+	{
+		finder.addMatcher(objectMatcher, &callback);
+		tool.appendArgumentsAdjuster(getInsertArgumentAdjuster(CommandLineArguments{ "--target=" + target }, ArgumentInsertPosition::END));
+		LayoutActionFactory factory(finder);
+		const int result = tool.run(&factory);
+		return gtr::Failed() ? EXIT_FAILURE : result;
+	}
+
+	finder.addMatcher(enumMatcher, &callback);
+	finder.addMatcher(objectMatcher, &callback);
+	finder.addMatcher(fieldMatcher, &callback);
+
+	const int result = tool.run(newFrontendActionFactory(&finder).get());
+	return gtr::Failed() ? EXIT_FAILURE : result;
+}
+
+[[nodiscard]] static std::string project_dir(const Options& options) noexcept
+{
+	GTR_ASSERT_OR
+	(
+		std::filesystem::exists(options.Dir) && std::filesystem::is_directory(options.Dir), std::string(),
+		"Couldn't find directory: %s\n", options.Dir.c_str()
+	);
+	return std::filesystem::absolute(options.Dir).string();
+}
+
+/**
+* @brief Everything that the outputs of a step depend on besides the files it keeps and the headers it reads
+* @details The first line of clangdump.hpp is skipped, it's a timestamp.
+*/
+[[nodiscard]] static std::string cache_inputs(const Options& options, const std::string& clangfile, const std::string& clangpath) noexcept
+{
+	std::ostringstream inputs;
+	inputs << "gtreflect " << __DATE__ << ' ' << __TIME__ << '\n';//Other builds may generate something else
+	inputs << (options.IsPrebuild ? "prebuild" : "postbuild") << " registry=" << options.Registry << " layout=" << options.LayoutReport <<
+		" db=" << options.Database << '\n';
+	for (const auto& target : options.Targets)
+		inputs << "target=" << target << '\n';
+	inputs << "host=" << llvm::sys::getDefaultTargetTriple() << '\n';
+	for (const auto& command : compilation_database(clangpath)->getCompileCommands(clangpath))
+	{
+		inputs << command.Directory;
+		for (const auto& arg : command.CommandLine)
+			inputs << ' ' << arg;
+		inputs << '\n';
+	}
+	inputs << ReflectionCache::Hash(std::string_view(clangfile).substr(clangfile.find('\n') + 1));
+	return inputs.str();
+}
+
+//Files that a step reads and writes
+[[nodiscard]] static std::vector<std::filesystem::path> cache_state(const std::filesystem::path& dir, bool prebuild) noexcept
+{
+	std::vector<std::filesystem::path> state = { dir / ".gt/typeids.cache" };
+	if (prebuild)
+		return state;
+
+	state.push_back(dir / ".gt/enums.cache");
+	std::error_code error;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(dir / "Assets", error))
+	{
+		const auto extension = entry.path().extension();
+		if (extension.compare(".gtscript") == 0 || extension.compare(".gtcomp") == 0 || extension.compare(".gtsystem") == 0)
+			state.push_back(entry.path());
+	}
+	return state;
+}
+
+[[nodiscard]] static Reflection prebuild(const Options& options, FileCache* cache) noexcept
+{
+	gtr::Log("------ Prebuild Step ------\n");
+	const auto start = std::chrono::steady_clock::now();
+	Notifier notifier(options.Endpoint, options.Timeout);
+	if (!options.Endpoint.empty())
+		notifier.Post("BuildStarted");
+
+	Reflection reflection;
+	const auto dir = project_dir(options);
+	if (gtr::Failed())
+		return reflection;
+
+	//Other configurations wait here and then find the project up to date, lint warnings need the bodies so it always parses
+	const ReflectionCache results(dir);
+	const ProjectLock lock = results.Lock();
+	const bool cacheable = lock.Locked() && options.Cache && options.WriteFiles && !options.Lint;
+
+	PrebuildFinder prebuildFinder(dir.c_str(), options);
+	std::ostringstream clangfile;
+	CreateClangFile(clangfile, dir);
+	const auto clangpath = std::filesystem::path(dir) / sClangFile;
+	prebuildFinder.Files.Write(clangpath) << clangfile.str();
+
+	const auto inputs = cacheable ? cache_inputs(options, clangfile.str(), clangpath.string()) : std::string();
+	if (cacheable && results.Restore(results.Key(inputs, cache_state(dir, true))))
+	{
+		gtr::Log("Reflection is up to date\n");
+		reflection.Result = EXIT_SUCCESS;
+		reflection.Cached = true;
+	}
+	else
+	{
+		const ToolFiles files(dir, clangpath.string(), clangfile.str(), cache);
+		reflection.Result = run_tool(prebuildFinder, files);
+		if (reflection.Result != 0)
+			gtr::LogError("Reflection's prebuild step failed!\n");
+		else if (options.WriteFiles)
+		{
+			prebuildFinder.Files.Flush();
+			if (cacheable)
+				results.Store(results.Key(inputs, cache_state(dir, true)), files.Dependencies(), prebuildFinder.Files.Files(), prebuildFinder.Files.Removed());
+		}
+
+		reflection.Objects = std::move(prebuildFinder.Objects);
+		reflection.Enums = std::move(prebuildFinder.Enums);
+		reflection.Files = std::move(prebuildFinder.Files);
+	}
+	notifier.Wait();
+	reflection.Elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	gtr::Log("---------------------------\n");
+	return reflection;
+}
+
+[[nodiscard]] static Reflection postbuild(const Options& options, FileCache* cache) noexcept
+{
+	gtr::Log("------ Postbuild Step ------\n");
+	const auto start = std::chrono::steady_clock::now();
+	Reflection reflection;
+	const auto dir = project_dir(options);
+	if (gtr::Failed())
+		return reflection;
+
+	//Publishing is meant for the Engine that is running now, so it always parses
+	const ReflectionCache results(dir);
+	const ProjectLock lock = results.Lock();
+	const bool cacheable = lock.Locked() && options.Cache && options.WriteFiles && !options.Publish;
+
+	PostbuildFinder postbuildFinder(dir.c_str(), options);
+	std::ostringstream clangfile;
+	CreateClangFile(clangfile, dir);
+	const auto clangpath = std::filesystem::path(dir) / sClangFile;
+	postbuildFinder.Files.Write(clangpath) << clangfile.str();
+
+	const auto manifest = std::filesystem::path(dir) / ".gt/changes.manifest";
+	const auto inputs = cacheable ? cache_inputs(options, clangfile.str(), clangpath.string()) : std::string();
+	if (cacheable && results.Restore(results.Key(inputs, cache_state(dir, false))))
+	{
+		//Same as parsing again, nothing has changed since the last time
+		gtr::Log("Reflection is up to date\n");
+		ChangeManifest().Write(reflection.Files.Write(manifest));
+		reflection.Files.Flush();
+		reflection.Result = EXIT_SUCCESS;
+		reflection.Cached = true;
+	}
+	else
+	{
+		//Other targets are parsed first, so their layouts are written on the assets together with the host's
+		const ToolFiles files(dir, clangpath.string(), clangfile.str(), cache);
+		for (const auto& target : options.Targets)
+		{
+			gtr::Log("Laying out for %s\n", target.c_str());
+			TargetFinder targetFinder;
+			if (run_tool(targetFinder, files, target) != 0)
+			{
+				gtr::LogError("Reflection's postbuild step failed for %s!\n", target.c_str());
+				reflection.Elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+				return reflection;
+			}
+			postbuildFinder.TargetLayouts[target] = std::move(targetFinder.Layouts);
+		}
+
+		reflection.Result = run_tool(postbuildFinder, files);
+		if (reflection.Result != 0)
+		{
+			gtr::LogError("Reflection's postbuild step failed!\n");
+			reflection.Elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+			return reflection;
+		}
+		if (options.WriteFiles)
+		{
+			postbuildFinder.Files.Flush();
+			//The manifest of a run with nothing to do is empty, it is written on hits instead
+			if (cacheable)
+			{
+				auto outputs = postbuildFinder.Files.Files();
+				outputs.erase(std::remove(outputs.begin(), outputs.end(), manifest.lexically_normal()), outputs.end());
+				results.Store(results.Key(inputs, cache_state(dir, false)), files.Dependencies(), outputs, postbuildFinder.Files.Removed());
+			}
+		}
+
+		reflection.Objects = std::move(postbuildFinder.Objects);
+		reflection.Enums = std::move(postbuildFinder.Enums);
+		reflection.Files = std::move(postbuildFinder.Files);
+		reflection.Changes = postbuildFinder.Changes();
+		reflection.Generation = postbuildFinder.Generation;
+	}
+
+	//Engine reads the manifest to find out what should be reloaded
+	if (!options.Endpoint.empty())
+	{
+		Notifier notifier(options.Endpoint, options.Timeout);
+		if (reflection.Generation != 0)
+		{
+			//Delivered before BuildEnded, so the engine maps the new model before it reloads
+			notifier.Post("ModelPublished:" + SharedModelName(dir) + "." + std::to_string(reflection.Generation));
+			notifier.Wait();
+		}
+		notifier.Post("BuildEnded:" + manifest.string());
+		notifier.Wait();
+	}
+	reflection.Elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	gtr::Log("----------------------------\n");
+	return reflection;
+}
+
+[[nodiscard]] Reflection PrebuildRun(const Options& options) noexcept
+{
+	return prebuild(options, nullptr);
+}
+
+[[nodiscard]] Reflection PostbuildRun(const Options& options) noexcept
+{
+	return postbuild(options, nullptr);
+}
+
+/**
+* @brief Runs the projects of a batch on worker threads
+* @details Each project logs on its own RunLog, which is printed as a whole once the project is done.
+*	A GTR_ASSERT that fails marks the RunLog as failed, so the project returns early with EXIT_FAILURE
+*	and its worker goes on with the next one.
+*/
+class BatchRunner {
+public:
+	BatchRunner(const Options& options, BatchReflection& batch) noexcept
+		: mOptions(options), mBatch(batch) {}
+
+	[[nodiscard]] const FileCache& Cache(void) const noexcept { return mCache; }
+
+	void Run(unsigned jobs) noexcept
+	{
+		for (size_t i = 0; i < mOptions.Batch.size(); i++)
+		{
+			if (std::filesystem::is_directory(mOptions.Batch[i]))
+				continue;
+			gtr::LogError("Couldn't find directory: %s\n", mOptions.Batch[i].c_str());
+			mSkipped.push_back(i);
+		}
+
+		std::vector<std::thread> workers;
+		for (unsigned i = 0; i < jobs; i++)
+			workers.emplace_back(&BatchRunner::Work, this);
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+private:
+	void Work(void) noexcept
+	{
+		for (size_t i = Take(); i < mOptions.Batch.size(); i = Take())
+		{
+			Options project = mOptions;
+			project.Dir = mOptions.Batch[i];
+			project.Batch.clear();
+
+			gtr::RunLog log;
+			const auto start = std::chrono::steady_clock::now();
+			gtr::tRunLog = &log;
+			Reflection reflection = mOptions.IsPrebuild ? prebuild(project, &mCache) : postbuild(project, &mCache);
+			gtr::tRunLog = nullptr;
+			if (log.Failed)
+			{
+				reflection.Result = EXIT_FAILURE;
+				reflection.Elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+			}
+
+			std::lock_guard lock(mMutex);
+			mBatch.Projects[i] = std::move(reflection);
+			print(i, log);
+		}
+	}
+
+	//Next project that nobody has taken yet, projects whose directory is missing are skipped
+	[[nodiscard]] size_t Take(void) noexcept
+	{
+		for (size_t i = mNext++; i < mOptions.Batch.size(); i = mNext++)
+		{
+			if (std::find(mSkipped.begin(), mSkipped.end(), i) == mSkipped.end())
+				return i;
+		}
+		return mOptions.Batch.size();
+	}
+
+	//Must be called with mMutex locked
+	void print(size_t index, const gtr::RunLog& log) const noexcept
+	{
+		printf("====== %s ======\n%s", mOptions.Batch[index].c_str(), log.Text.c_str());
+		fflush(stdout);
+	}
+
+private:
+	const Options& mOptions;
+	BatchReflection& mBatch;
+	FileCache mCache;
+	std::mutex mMutex;
+	std::vector<size_t> mSkipped;//Written before any worker starts
+	std::atomic<size_t> mNext{ 0 };
+};
+
+[[nodiscard]] BatchReflection BatchRun(const Options& options) noexcept
+{
+	const auto start = std::chrono::steady_clock::now();
+	BatchReflection batch;
+	batch.Projects.resize(options.Batch.size());
+
+	unsigned jobs = options.Jobs != 0 ? options.Jobs : std::thread::hardware_concurrency();
+	jobs = std::clamp(jobs, 1u, (unsigned)std::max<size_t>(options.Batch.size(), 1));
+
+	BatchRunner runner(options, batch);
+	runner.Run(jobs);
+	const FileCache& cache = runner.Cache();
+
+	//Summary
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	std::chrono::milliseconds total{ 0 };
+	size_t failed = 0;
+	gtr::Log("------ Batch Summary ------\n");
+	for (size_t i = 0; i < options.Batch.size(); i++)
+	{
+		const auto& reflection = batch.Projects[i];
+		total += reflection.Elapsed;
+		if (reflection.Result != 0)
+			failed++;
+		const char* status = reflection.Result != 0 ? "failed" : reflection.Cached ? "cached" : "ok";
+		gtr::Log("%9.3fs %-6s %s\n", reflection.Elapsed.count() / 1000.0, status, options.Batch[i].c_str());
+	}
+	gtr::Log("%zu projects (%zu failed) on %u jobs\n", options.Batch.size(), failed, jobs);
+	gtr::Log("Wall time %.3fs, sum of projects %.3fs\n", elapsed.count() / 1000.0, total.count() / 1000.0);
+	gtr::Log("Header lookups: %zu from disk, %zu from cache\n", cache.Misses(), cache.Hits());
+	gtr::Log("---------------------------\n");
+
+	batch.Result = failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	batch.Elapsed = elapsed;
+	return batch;
+}
+
+//Paths of headers are relative to root, which is the project's directory
+static void GetFilesR(const std::filesystem::path& dir, const std::filesystem::path& root, std::vector<std::string>& headers)
+{
+	for (auto dirEntry : std::filesystem::directory_iterator(dir))
+	{
+		const auto& path = dirEntry.path();
+		const auto relative = std::filesystem::relative(path, root);
+		if (dirEntry.is_directory())
+			GetFilesR(path, root, headers);
+		else
+		{
+			const auto& extension = relative.extension().string();
+			if (extension.compare(".hpp") == 0)
+				headers.push_back(relative.string());
+			else if (extension.compare(".h") == 0)
+				headers.push_back(relative.string());
+		}
+	}
+}
+
+static void WriteClangFileR(std::ostream& output, std::vector<std::string>& done, const std::string& header, const std::filesystem::path& root)
+{
+	if (std::find(done.begin(), done.end(), (root / header).string()) != done.end())
+		return;
+
+	gtr::Log("%s\n", std::filesystem::path(header).filename().string().c_str());
+	
+	const auto dir = header.substr(0, header.find_last_of("/\\"));
+	done.push_back((root / header).string());
+	std::ifstream input(root / header);
+	std::string line;
+
+	//Line markers keep declarations pointing to their own header, so enumerations know where they come from
+	const auto marker = "\"" + std::filesystem::path(header).generic_string() + "\"\n";
+	size_t lineno = 0;
+	output << "#line 1 " << marker;
+	while (std::getline(input, line))
+	{
+		lineno++;
+		if (line.compare("#pragma once") == 0)
+		{
+			output << '\n';
+			continue;
+		}
+		const auto check = line.substr(0, 8);
+		if (line.find("#define") != std::string::npos)//TODO(Vasilis): Maybe remove
+		{
+			output << line << '\n';
+			continue;
+		}
+		else if (line.find("CLASS(") != std::string::npos ||
+			line.find("COMPONENT(") != std::string::npos ||
+			line.find("SYSTEM(") != std::string::npos)
+		{
+			//Every argument is kept, header is added in front of them
+			size_t index = line.find("(");
+			const auto args = line.substr(index + 1);
+			output << line.substr(0, index) <<"(header=\"" << header << "\"";
+			const size_t start = args.find_first_not_of(" \t");
+			if (start != std::string::npos && args[start] != ')')
+				output << ", " << args.substr(start) << '\n';
+			else
+				output << ")\n";
+			continue;
+		}
+		else if (line.find("std::string") != std::string::npos)
+		{
+			size_t index = line.find("std::string");
+			while (index != std::string::npos)
+			{
+				line = line.replace(line.begin() + index, line.begin() + index + 11, "dumm::String");
+				index = line.find("std::string");
+			}
+			output << line << '\n';
+			continue;
+		}
+		else if (check.find("#include") == std::string::npos)
+		{
+			output << line << '\n';
+			continue;
+		}
+
+		const size_t start = std::min(std::string(line).find('"'), std::string(line).find('<'));
+		const size_t end = std::min(std::string(line).find_last_of('"'), std::string(line).find_last_of('>'));
+
+		auto toinclude = line.substr(start + 1, end - start - 1);
+		if (std::find(done.cbegin(), done.cend(), toinclude) != done.cend())//Already included
+		{
+			output << '\n';
+			continue;
+		}
+		if (!std::filesystem::exists(root / (dir + "/" + toinclude)) && !std::filesystem::exists(root / toinclude))//Including 3rdParty Header that hasn't been included
+		{
+			output << line << '\n';
+			done.push_back(toinclude);
+		}
+
+		const auto absheader = std::filesystem::exists(root / toinclude) ? root / toinclude : root / (dir + "/" + toinclude);
+		if (std::find(done.cbegin(), done.cend(), absheader) == done.cend())
+			WriteClangFileR(output, done, dir + "/" + toinclude, root);
+		output << "#line " << lineno + 1 << ' ' << marker;
+	}
+}
+
+static void CreateClangFile(std::ostream& output, const std::filesystem::path& root) noexcept
+{
+	gtr::Log("Start building clangdump.hpp\n");
+	const auto project = (root.has_filename() ? root : root.parent_path()).filename();
+	const auto current = root / project / "src";
+		
+	std::vector<std::string> headers;
+	GetFilesR(current, root, headers);
+
+	output << "//Auto Generated file by gtreflect.exe at " << Timestamp();
+	output << "#include \"dummstring.h\"\n";
+
+	std::vector<std::string> done = { "string", "string_view" };
+	for (auto& header : headers)
+		WriteClangFileR(output, done, header, root);
+
+	gtr::Log("Done building clangdump.hpp\n");
+}
\ No newline at end of file
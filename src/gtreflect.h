@@ -0,0 +1,59 @@
+#pragma once
+
+#include "reflect.h"
+#include "Artifacts.h"
+#include "Manifest.h"
+#include "Options.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+* @brief Everything produced by a single run of reflection
+*/
+struct Reflection {
+	int Result = EXIT_FAILURE;
+	std::unordered_map<std::string, Object> Objects;
+	std::unordered_map<std::string, Enum> Enums;
+	/**
+	* @brief Generated files (Exports, assets, caches, manifest) with paths under the project's directory
+	* @details Already on disk when Options::WriteFiles is set
+	*/
+	Artifacts Files;
+	ChangeManifest Changes;//Only on postbuild
+	uint64_t Generation = 0;//Of the model published on shared memory, only on postbuild with Options::Publish
+	std::chrono::milliseconds Elapsed{ 0 };
+	bool Cached = false;//The project was up to date on the reflection cache, nothing was parsed so only Result (and Changes, which is empty) can be used
+};
+
+/**
+* @brief Everything produced by a run of reflection on several projects
+*/
+struct BatchReflection {
+	int Result = EXIT_FAILURE;//Fails when any of the projects fails
+	std::vector<Reflection> Projects;//Same order as Options::Batch
+	std::chrono::milliseconds Elapsed{ 0 };
+};
+
+/**
+* @brief Runs the reflection's prebuild step on the project described by options
+* @details Can be called in-process (by the editor or a build orchestrator) as many times as needed.
+*	The current directory is never changed, so runs on different projects can happen on different threads.
+*/
+[[nodiscard]] Reflection PrebuildRun(const Options& options) noexcept;
+
+/**
+* @brief Runs the reflection's postbuild step on the project described by options
+* @details Same as PrebuildRun()
+*/
+[[nodiscard]] Reflection PostbuildRun(const Options& options) noexcept;
+
+/**
+* @brief Runs the same step on every project of Options::Batch, Options::Jobs of them at a time
+* @details Projects share the process and a cache of the headers that clang reads from disk, so headers that
+*	all of them include (the Engine's) are read and looked up once. A summary with the time of every project
+*	is printed at the end.
+*	The output of each project is printed as a whole when it finishes, and a failed GTR_ASSERT fails only that project,
+*	whose Reflection::Result is then EXIT_FAILURE.
+*/
+[[nodiscard]] BatchReflection BatchRun(const Options& options) noexcept;
@@ -1,259 +1,420 @@
-#pragma once
-
-#include <cstdio>
-#include <string>
-#include <yaml-cpp/yaml.h>
-#include <vector>
-
-//This assertion terminates the application
-#define GTR_ASSERT(x, format, ...) { if(!(x)){ fprintf(stderr, format, __VA_ARGS__); exit(EXIT_FAILURE); }}
-
-/**
-* @brief Enumaration for every kind of type that a
-*	reflective field can possibly have.
-*/
-enum class FieldType : unsigned char {
-	Unknown = 0,
-
-	Bool,
-	Char,
-	Byte,//unsigned char
-
-	Int16,
-	Int32,
-	Int64,
-	Uint16,
-	Uint32,
-	Uint64,
-
-	Float32,
-	Float64,
-
-
-	//Vectors
-	Vec2,
-	Vec3,
-	Vec4,
-
-	//Enumerations
-	Enum_Char,
-	Enum_Byte,
-	Enum_Int16,
-	Enum_Int32,
-	Enum_Int64,
-	Enum_Uint16,
-	Enum_Uint32,
-	Enum_Uint64,
-
-	String,
-    
-    //Engine's Objects
-    Asset,
-	Entity
-};
-
-enum class ReflectionType {
-	Unknown = 0,
-	Enumaration,
-	Component,
-	System,
-	Object,
-	Property,
-	Method,
-};
-
-struct Metadata {
-	std::string Name;
-	size_t Size = 0;
-	ReflectionType Type = ReflectionType::Unknown;
-	Metadata(void) = default;
-	Metadata(const std::string& name, size_t size) noexcept
-		: Name(name), Size(size) {}
-	Metadata(const std::string& name, size_t size, ReflectionType type) noexcept
-		: Name(name), Size(size), Type(type) {}
-};
-
-struct FieldMetadata : public Metadata {
-	FieldType ValueType = FieldType::Unknown;
-	union {
-		size_t Length = 0;
-		int64_t MinInt;
-		uint64_t MinUint;
-		double MinFloat;
-	};
-	union {
-		int64_t MaxInt = 0;
-		uint64_t MaxUint;
-		double MaxFloat;
-	};
-	FieldMetadata(void) = default;
-	FieldMetadata(const std::string& name, size_t size) noexcept
-		: Metadata(name, size, ReflectionType::Property) {}
-	FieldMetadata(const std::string& name, size_t size, FieldType type) noexcept
-		: Metadata(name, size, ReflectionType::Property), ValueType(type) {}
-};
-
-struct Field {
-	FieldMetadata Meta;
-	std::string TypeName;
-	/*
-	* @brief Real Name
-	* @details Name used in C++ on the contrary Meta.Name is used on editor
-	*/
-	std::string Name;
-	size_t Offset = 0;
-	YAML::Node Default;
-
-	[[nodiscard]] bool operator==(const Field& other) const noexcept
-	{
-		if (Offset != other.Offset) return false;
-		if (Meta.Size != other.Meta.Size) return false;
-		if (Meta.ValueType != other.Meta.ValueType) return false;
-		if (Meta.Name.compare(other.Meta.Name) != 0) return false;
-		switch (Meta.ValueType)
-		{
-		case FieldType::Char:
-		case FieldType::Enum_Char:
-		case FieldType::Int16:
-		case FieldType::Enum_Int16:
-		case FieldType::Int32:
-		case FieldType::Enum_Int32:
-		case FieldType::Int64:
-		case FieldType::Enum_Int64:
-			if (Meta.MinInt != other.Meta.MinInt) return false;
-			if (Meta.MaxInt != other.Meta.MaxInt) return false;
-			break;
-		case FieldType::Byte:
-		case FieldType::Enum_Byte:
-		case FieldType::Uint16:
-		case FieldType::Enum_Uint16:
-		case FieldType::Uint32:
-		case FieldType::Enum_Uint32:
-		case FieldType::Uint64:
-		case FieldType::Enum_Uint64:
-			if (Meta.MinUint != other.Meta.MinUint) return false;
-			if (Meta.MaxUint != other.Meta.MaxUint) return false;
-			break;
-		case FieldType::Float32:
-		case FieldType::Float64:
-		case FieldType::Vec2:
-		case FieldType::Vec3:
-		case FieldType::Vec4:
-			if (Meta.MinFloat != other.Meta.MinFloat) return false;
-			if (Meta.MaxFloat != other.Meta.MaxFloat) return false;
-			break;
-		case FieldType::String:
-			if (Meta.Length != other.Meta.Length) return false;
-			break;
-		}
-		return true;
-	}
-
-	[[nodiscard]] bool isEnum(void) noexcept
-	{
-		return Meta.ValueType == FieldType::Enum_Char || Meta.ValueType == FieldType::Enum_Byte ||
-			Meta.ValueType == FieldType::Enum_Int16 || Meta.ValueType == FieldType::Enum_Int32 || Meta.ValueType == FieldType::Enum_Int64 ||
-			Meta.ValueType == FieldType::Enum_Uint16 || Meta.ValueType == FieldType::Enum_Uint32 || Meta.ValueType == FieldType::Enum_Uint64;
-	}
-
-	[[nodiscard]] inline bool isUnsigned(void) const noexcept
-	{ 
-		return Meta.ValueType == FieldType::Enum_Byte || Meta.ValueType == FieldType::Enum_Uint16 || Meta.ValueType == FieldType::Enum_Uint32 || Meta.ValueType == FieldType::Enum_Uint64 ||
-			Meta.ValueType == FieldType::Byte || Meta.ValueType == FieldType::Uint16 || Meta.ValueType == FieldType::Uint32 || Meta.ValueType == FieldType::Uint64;
-	}
-
-
-	[[nodiscard]] inline bool isEnum(void) const noexcept
-	{
-		return Meta.ValueType == FieldType::Enum_Char || Meta.ValueType == FieldType::Enum_Byte ||
-			Meta.ValueType == FieldType::Enum_Int16 || Meta.ValueType == FieldType::Enum_Int32 || Meta.ValueType == FieldType::Enum_Int64 ||
-			Meta.ValueType == FieldType::Enum_Uint16 || Meta.ValueType == FieldType::Enum_Uint32 || Meta.ValueType == FieldType::Enum_Uint64;
-	}
-
-	[[nodiscard]] bool operator!=(const Field& other) const noexcept { return !(*this == other); }
-
-	Field(void) = default;
-	Field(const std::string& name, size_t size, size_t offset) noexcept
-		: Meta(name, size), Name(name), Offset(offset) {}
-	Field(const std::string& name, size_t size, size_t offset, FieldType type) noexcept
-		: Meta(name, size, type), Name(name), Offset(offset) {}
-};
-
-struct EnumValue {
-	union {
-		int64_t Value = 0;
-		uint64_t Uvalue;
-	};
-	EnumValue(void) = default;
-	EnumValue(int64_t value) noexcept
-		: Value(value) {}
-	EnumValue(uint64_t value) noexcept
-		: Uvalue(value) {}
-};
-
-struct Enum {
-	Metadata Meta;
-	/*
-	* @brief Real Name
-	* @details Name used in C++ on the contrary Meta.Name is used on editor
-	*/
-	std::string Name;
-	FieldType Type;
-	std::map<std::string, EnumValue> Values;
-	[[nodiscard]] inline bool isUnsigned(void) const { return Type == FieldType::Enum_Byte || Type == FieldType::Enum_Uint16 || Type == FieldType::Enum_Uint32 || Type == FieldType::Enum_Uint64; }
-	
-	/*
-	* @brief Checks whether two enums should be consider the same by GreenTea Engine
-	*/
-	[[nodiscard]] bool operator==(const Enum& other) const noexcept
-	{
-		if (isUnsigned() != other.isUnsigned()) return false;
-		if (Meta.Name.compare(other.Meta.Name) != 0) return false;
-		if (other.Meta.Size != Meta.Size) return false;
-		for (const auto& [key, val] : Values)
-		{
-			if (other.Values.find(key) == other.Values.end()) return false;
-			if (isUnsigned()) { if (other.Values.at(key).Uvalue != val.Uvalue) return false; }
-			else { if (other.Values.at(key).Value != val.Value) return false; }
-		}
-		return true;
-	}
-	
-	[[nodiscard]] bool operator!=(const Enum& other) const noexcept { return !(*this == other); }
-
-	Enum(void) = default;
-	Enum(const std::string& name, size_t size) noexcept
-		: Meta(name, size, ReflectionType::Enumaration), Name(name), Type(FieldType::Unknown) {}
-	Enum(const std::string& name, size_t size, FieldType type) noexcept 
-		: Meta(name, size, ReflectionType::Enumaration), Name(name), Type(type) {}
-};
-
-struct Object {
-	Metadata Meta;
-	/*
-	* @brief Real Name
-	* @details Name used in C++ on the contrary Meta.Name is used on editor
-	*/
-	std::string Name;
-	std::string Header;
-	std::vector<Field> Fields;
-	uint64_t Version = 1;
-
-	[[nodiscard]] bool operator==(const Object& other) const noexcept
-	{
-		if (Meta.Name.compare(other.Meta.Name) != 0) return false;
-		if (Fields.size() != other.Fields.size()) return false;
-		for (size_t i = 0; i < Fields.size(); i++)
-		{
-			if (Fields[i] != other.Fields[i]) return false;
-		}
-		return true;
-	}
-
-	[[nodiscard]] bool operator!=(const Object& other) const noexcept { return !(*this == other); }
-	Object(void) = default;
-	Object(const std::string& name, size_t size) noexcept
-		: Meta(name, size), Name(name) {}
-	Object(const std::string& name, size_t size, ReflectionType type) noexcept
-		: Meta(name, size, type), Name(name) {}
-};
+#pragma once
+
+#include "Log.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <string>
+#include <yaml-cpp/yaml.h>
+#include <vector>
+
+//This assertion terminates the application, or on a batch fails the project and returns from the function (format is the first of the variadic arguments so it works without any other)
+#define GTR_ASSERT(x, ...) { if(!(x)){ gtr::Fail(__VA_ARGS__); return; }}
+//Same as GTR_ASSERT on functions that return something, value is returned when only the project fails
+#define GTR_ASSERT_OR(x, value, ...) { if(!(x)){ gtr::Fail(__VA_ARGS__); return value; }}
+
+/**
+* @brief Enumaration for every kind of type that a
+*	reflective field can possibly have.
+*/
+enum class FieldType : unsigned char {
+	Unknown = 0,
+
+	Bool,
+	Char,
+	Byte,//unsigned char
+
+	Int16,
+	Int32,
+	Int64,
+	Uint16,
+	Uint32,
+	Uint64,
+
+	Float32,
+	Float64,
+
+
+	//Vectors
+	Vec2,
+	Vec3,
+	Vec4,
+
+	//Enumerations
+	Enum_Char,
+	Enum_Byte,
+	Enum_Int16,
+	Enum_Int32,
+	Enum_Int64,
+	Enum_Uint16,
+	Enum_Uint32,
+	Enum_Uint64,
+
+	String,
+    
+    //Engine's Objects
+    Asset,
+	Entity
+};
+
+enum class ReflectionType {
+	Unknown = 0,
+	Enumaration,
+	Component,
+	System,
+	Object,
+	Property,
+	Method,
+};
+
+struct Metadata {
+	std::string Name;
+	size_t Size = 0;
+	ReflectionType Type = ReflectionType::Unknown;
+	Metadata(void) = default;
+	Metadata(const std::string& name, size_t size) noexcept
+		: Name(name), Size(size) {}
+	Metadata(const std::string& name, size_t size, ReflectionType type) noexcept
+		: Name(name), Size(size), Type(type) {}
+};
+
+struct FieldMetadata : public Metadata {
+	FieldType ValueType = FieldType::Unknown;
+	union {
+		size_t Length = 0;
+		int64_t MinInt;
+		uint64_t MinUint;
+		double MinFloat;
+	};
+	union {
+		int64_t MaxInt = 0;
+		uint64_t MaxUint;
+		double MaxFloat;
+	};
+	FieldMetadata(void) = default;
+	FieldMetadata(const std::string& name, size_t size) noexcept
+		: Metadata(name, size, ReflectionType::Property) {}
+	FieldMetadata(const std::string& name, size_t size, FieldType type) noexcept
+		: Metadata(name, size, ReflectionType::Property), ValueType(type) {}
+};
+
+struct Field {
+	FieldMetadata Meta;
+	std::string TypeName;
+	/*
+	* @brief Real Name
+	* @details Name used in C++ on the contrary Meta.Name is used on editor
+	*/
+	std::string Name;
+	size_t Offset = 0;
+	YAML::Node Default;
+	double Precision = 0.0;//Step of quantized floats & vecs (precision=), only available while parsing
+	bool Hot = false;//Own array on structure-of-arrays storage (split=hot), only available while parsing
+
+	[[nodiscard]] bool operator==(const Field& other) const noexcept
+	{
+		if (Offset != other.Offset) return false;
+		if (Meta.Size != other.Meta.Size) return false;
+		if (Meta.ValueType != other.Meta.ValueType) return false;
+		if (Meta.Name.compare(other.Meta.Name) != 0) return false;
+		switch (Meta.ValueType)
+		{
+		case FieldType::Char:
+		case FieldType::Enum_Char:
+		case FieldType::Int16:
+		case FieldType::Enum_Int16:
+		case FieldType::Int32:
+		case FieldType::Enum_Int32:
+		case FieldType::Int64:
+		case FieldType::Enum_Int64:
+			if (Meta.MinInt != other.Meta.MinInt) return false;
+			if (Meta.MaxInt != other.Meta.MaxInt) return false;
+			return sameDefault(Default["Default"], other.Default["Default"]);
+		case FieldType::Byte:
+		case FieldType::Enum_Byte:
+		case FieldType::Uint16:
+		case FieldType::Enum_Uint16:
+		case FieldType::Uint32:
+		case FieldType::Enum_Uint32:
+		case FieldType::Uint64:
+		case FieldType::Enum_Uint64:
+			if (Meta.MinUint != other.Meta.MinUint) return false;
+			if (Meta.MaxUint != other.Meta.MaxUint) return false;
+			return sameDefault(Default["Default"], other.Default["Default"]);
+		case FieldType::Float32:
+		case FieldType::Float64:
+		case FieldType::Vec2:
+		case FieldType::Vec3:
+		case FieldType::Vec4:
+			if (Meta.MinFloat != other.Meta.MinFloat) return false;
+			if (Meta.MaxFloat != other.Meta.MaxFloat) return false;
+			return sameDefault(Default["Default"], other.Default["Default"]);
+		case FieldType::String:
+			if (Meta.Length != other.Meta.Length) return false;
+			return sameDefault(Default["Default"], other.Default["Default"]);
+		case FieldType::Bool:
+			return sameDefault(Default["Default"], other.Default["Default"]);
+		}
+		return true;
+	}
+
+	/**
+	* @brief Compares default values as they are written on the assets
+	* @details A default that changes has to bump the version, the default image of the asset is baked from it
+	*/
+	[[nodiscard]] static bool sameDefault(const YAML::Node& lhs, const YAML::Node& rhs) noexcept
+	{
+		if (lhs.IsDefined() != rhs.IsDefined()) return false;
+		if (!lhs.IsDefined()) return true;
+		if (lhs.Type() != rhs.Type()) return false;
+		if (lhs.IsScalar()) return lhs.Scalar().compare(rhs.Scalar()) == 0;
+		if (!lhs.IsSequence()) return true;
+		if (lhs.size() != rhs.size()) return false;
+		for (size_t i = 0; i < lhs.size(); i++)
+		{
+			if (!sameDefault(lhs[i], rhs[i])) return false;
+		}
+		return true;
+	}
+
+	[[nodiscard]] bool isEnum(void) noexcept
+	{
+		return Meta.ValueType == FieldType::Enum_Char || Meta.ValueType == FieldType::Enum_Byte ||
+			Meta.ValueType == FieldType::Enum_Int16 || Meta.ValueType == FieldType::Enum_Int32 || Meta.ValueType == FieldType::Enum_Int64 ||
+			Meta.ValueType == FieldType::Enum_Uint16 || Meta.ValueType == FieldType::Enum_Uint32 || Meta.ValueType == FieldType::Enum_Uint64;
+	}
+
+	[[nodiscard]] inline bool isUnsigned(void) const noexcept
+	{ 
+		return Meta.ValueType == FieldType::Enum_Byte || Meta.ValueType == FieldType::Enum_Uint16 || Meta.ValueType == FieldType::Enum_Uint32 || Meta.ValueType == FieldType::Enum_Uint64 ||
+			Meta.ValueType == FieldType::Byte || Meta.ValueType == FieldType::Uint16 || Meta.ValueType == FieldType::Uint32 || Meta.ValueType == FieldType::Uint64;
+	}
+
+
+	[[nodiscard]] inline bool isEnum(void) const noexcept
+	{
+		return Meta.ValueType == FieldType::Enum_Char || Meta.ValueType == FieldType::Enum_Byte ||
+			Meta.ValueType == FieldType::Enum_Int16 || Meta.ValueType == FieldType::Enum_Int32 || Meta.ValueType == FieldType::Enum_Int64 ||
+			Meta.ValueType == FieldType::Enum_Uint16 || Meta.ValueType == FieldType::Enum_Uint32 || Meta.ValueType == FieldType::Enum_Uint64;
+	}
+
+	[[nodiscard]] bool operator!=(const Field& other) const noexcept { return !(*this == other); }
+
+	Field(void) = default;
+	Field(const std::string& name, size_t size, size_t offset) noexcept
+		: Meta(name, size), Name(name), Offset(offset) {}
+	Field(const std::string& name, size_t size, size_t offset, FieldType type) noexcept
+		: Meta(name, size, type), Name(name), Offset(offset) {}
+};
+
+struct EnumValue {
+	union {
+		int64_t Value = 0;
+		uint64_t Uvalue;
+	};
+	EnumValue(void) = default;
+	EnumValue(int64_t value) noexcept
+		: Value(value) {}
+	EnumValue(uint64_t value) noexcept
+		: Uvalue(value) {}
+};
+
+struct Enum {
+	Metadata Meta;
+	/*
+	* @brief Real Name
+	* @details Name used in C++ on the contrary Meta.Name is used on editor
+	*/
+	std::string Name;
+	FieldType Type;
+	std::map<std::string, EnumValue> Values;
+	/*
+	* @brief Header where the enumeration is declared
+	* @details Only available while parsing, it isn't stored on the cache
+	*/
+	std::string Header;
+	[[nodiscard]] inline bool isUnsigned(void) const { return Type == FieldType::Enum_Byte || Type == FieldType::Enum_Uint16 || Type == FieldType::Enum_Uint32 || Type == FieldType::Enum_Uint64; }
+	
+	/*
+	* @brief Checks whether two enums should be consider the same by GreenTea Engine
+	*/
+	[[nodiscard]] bool operator==(const Enum& other) const noexcept
+	{
+		if (isUnsigned() != other.isUnsigned()) return false;
+		if (Meta.Name.compare(other.Meta.Name) != 0) return false;
+		if (other.Meta.Size != Meta.Size) return false;
+		if (Type != other.Type) return false;
+		if (Values.size() != other.Values.size()) return false;//Values were added or removed
+		for (const auto& [key, val] : Values)
+		{
+			if (other.Values.find(key) == other.Values.end()) return false;
+			if (isUnsigned()) { if (other.Values.at(key).Uvalue != val.Uvalue) return false; }
+			else { if (other.Values.at(key).Value != val.Value) return false; }
+		}
+		return true;
+	}
+	
+	[[nodiscard]] bool operator!=(const Enum& other) const noexcept { return !(*this == other); }
+
+	Enum(void) = default;
+	Enum(const std::string& name, size_t size) noexcept
+		: Meta(name, size, ReflectionType::Enumaration), Name(name), Type(FieldType::Unknown) {}
+	Enum(const std::string& name, size_t size, FieldType type) noexcept 
+		: Meta(name, size, ReflectionType::Enumaration), Name(name), Type(type) {}
+};
+
+/**
+* @brief Bytes taken by a member of a record, reflected or not
+* @details Also used for base classes & the virtual table pointer
+*/
+struct MemberLayout {
+	std::string Name;
+	size_t Offset = 0;
+	size_t Size = 0;
+	size_t Align = 1;
+	bool Movable = true;//Only fields can be reordered
+};
+
+enum class StorageKind : unsigned char {
+	Dense = 0,//Contiguous array, for components that most entities have
+	Sparse//Only entities that have the component take space
+};
+
+/**
+* @brief How the Engine should store the instances of a component
+* @details Set with instances=, chunk=, align= and storage= on the annotation, zero means that there is no hint
+*/
+struct StorageHints {
+	uint64_t Instances = 0;//Expected to be alive at once, so pools can be preallocated
+	uint32_t Chunk = 0;//Instances per chunk of the pool
+	uint32_t Align = 0;//Of every instance, at least the natural alignment
+	StorageKind Kind = StorageKind::Dense;
+
+	[[nodiscard]] bool operator==(const StorageHints& other) const noexcept
+	{
+		return Instances == other.Instances && Chunk == other.Chunk && Align == other.Align && Kind == other.Kind;
+	}
+	[[nodiscard]] bool operator!=(const StorageHints& other) const noexcept { return !(*this == other); }
+};
+
+/**
+* @brief Components that a system reads & writes according to the bodies of its member functions
+* @details Names are the C++ names of every type that was accessed, whether it is reflected or not
+*/
+struct AccessSet {
+	std::set<std::string> Reads;//Without the ones that are also written
+	std::set<std::string> Writes;
+	std::vector<std::string> Unresolved;//Functions reached from the system whose body isn't on the translation unit
+
+	[[nodiscard]] bool isComplete(void) const noexcept { return Unresolved.empty(); }
+
+	/**
+	* @brief Checks whether two systems can't run at the same time
+	* @details Incomplete sets conflict with everything
+	*/
+	[[nodiscard]] bool Conflicts(const AccessSet& other) const noexcept
+	{
+		if (!isComplete() || !other.isComplete()) return true;
+		for (const auto& name : Writes)
+		{
+			if (other.Writes.count(name) || other.Reads.count(name)) return true;
+		}
+		for (const auto& name : Reads)
+		{
+			if (other.Writes.count(name)) return true;
+		}
+		return false;
+	}
+};
+
+/**
+* @brief Size, alignment & fields of a record when compiled for another target
+* @details Offsets and Sizes are in the same order as Object::Fields
+*/
+struct TargetLayout {
+	size_t Size = 0;
+	size_t Align = 0;
+	std::vector<size_t> Offsets;
+	std::vector<size_t> Sizes;
+
+	[[nodiscard]] bool operator==(const TargetLayout& other) const noexcept
+	{
+		return Size == other.Size && Align == other.Align && Offsets == other.Offsets && Sizes == other.Sizes;
+	}
+	[[nodiscard]] bool operator!=(const TargetLayout& other) const noexcept { return !(*this == other); }
+};
+
+struct Object {
+	Metadata Meta;
+	/*
+	* @brief Real Name
+	* @details Name used in C++ on the contrary Meta.Name is used on editor
+	*/
+	std::string Name;
+	std::string Header;
+	std::vector<Field> Fields;
+	/*
+	* @brief Every member of the record as computed by clang
+	* @details Only available while parsing, it isn't stored on the assets
+	*/
+	std::vector<MemberLayout> Layout;
+	/*
+	* @brief Layout on every extra target by its triple (-targets=)
+	* @details Only set on postbuild, it is stored on the assets. Runs without -targets= keep the ones on the asset
+	*	while the fields don't change, so configurations with and without it don't change the version back and forth.
+	*/
+	std::map<std::string, TargetLayout> Targets;
+	StorageHints Storage;
+	/*
+	* @brief Components accessed by a system
+	* @details Only available while parsing and only for systems
+	*/
+	AccessSet Access;
+	/*
+	* @brief Whether a component gets a dirty mask & setters on the generated code (dirty=true)
+	* @details Only available while parsing
+	*/
+	bool TrackChanges = false;
+	/*
+	* @brief Whether a component gets structure-of-arrays storage on the generated code (soa=true)
+	* @details Only available while parsing
+	*/
+	bool Columnar = false;
+	/*
+	* @brief uuid of the asset
+	* @details Only available on postbuild after the assets have been written
+	*/
+	std::string Id;
+	uint64_t Version = 1;
+	/*
+	* @brief Dense id of components, stable across builds
+	* @details Persisted on .gt/typeids.cache, InvalidTypeId for anything that isn't a component
+	*/
+	uint32_t TypeId = InvalidTypeId;
+
+	static constexpr uint32_t InvalidTypeId = UINT32_MAX;
+
+	[[nodiscard]] bool operator==(const Object& other) const noexcept
+	{
+		if (Meta.Name.compare(other.Meta.Name) != 0) return false;
+		if (TypeId != other.TypeId) return false;
+		if (Storage != other.Storage) return false;
+		if (Targets != other.Targets) return false;
+		if (Fields.size() != other.Fields.size()) return false;
+		for (size_t i = 0; i < Fields.size(); i++)
+		{
+			if (Fields[i] != other.Fields[i]) return false;
+		}
+		return true;
+	}
+
+	[[nodiscard]] bool operator!=(const Object& other) const noexcept { return !(*this == other); }
+	Object(void) = default;
+	Object(const std::string& name, size_t size) noexcept
+		: Meta(name, size), Name(name) {}
+	Object(const std::string& name, size_t size, ReflectionType type) noexcept
+		: Meta(name, size, type), Name(name) {}
+};
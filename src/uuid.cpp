@@ -1,75 +1,297 @@
-//From https://github.com/VMormoris/GreenTea/blob/master/GreenTea/src/GreenTea/Core/uuid.cpp
-#include "uuid.h"
-
-#include <stdio.h>
-
-//From https://stackoverflow.com/questions/36262070/what-does-htons-do-on-a-big-endian-system
-#define FLIP_BYTES_S(n) (((((unsigned short)(n) & 0xFF)) << 8) | (((unsigned short)(n) & 0xFF00) >> 8))
-
-static constexpr GUID null = { 0 };
-static constexpr char nullstr[] = "00000000-0000-0000-0000-000000000000";
-
-//namespace gte {
-
-	//From https://stackoverflow.com/questions/18555306/convert-guid-structure-to-lpcstr
-[[nodiscard]] std::string uuid::str(void) const noexcept
-{
-	if (mUUID == null)
-		return std::string(nullstr);
-	char cstr[37] = { 0 };
-	sprintf_s
-	(
-		cstr,//Buffer
-		"%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X",//Format 
-		mUUID.Data1,//4 first bytes 
-		mUUID.Data2,//2 bytes
-		mUUID.Data3,//2 bytes
-		mUUID.Data4[0],//2 bytes
-		mUUID.Data4[1], mUUID.Data4[2], mUUID.Data4[3], mUUID.Data4[4], mUUID.Data4[5], mUUID.Data4[6], mUUID.Data4[7]//Last 6 bytes
-	);
-	return std::string(cstr);
-}
-
-uuid::uuid(const std::string& str) noexcept
-{
-	if (str.compare(nullstr) != 0)
-	{
-		sscanf_s(str.c_str(), "%08x", &mUUID.Data1);
-		sscanf_s(str.c_str() + 9, "%04hx", &mUUID.Data2);
-		sscanf_s(str.c_str() + 14, "%04hx", &mUUID.Data3);
-
-		unsigned short* ptr = (unsigned short*)&mUUID.Data4;
-		sscanf_s(str.c_str() + 19, "%04hx", ptr++);
-		sscanf_s(str.c_str() + 24, "%04hx", ptr++);
-		sscanf_s(str.c_str() + 28, "%04hx", ptr++);
-		sscanf_s(str.c_str() + 32, "%04hx", ptr);
-
-		ptr -= 3;
-		for (size_t i = 0; i < 4; i++)
-		{
-			*ptr = FLIP_BYTES_S(*ptr);
-			ptr++;
-		}
-	}
-}
-
-//TODO(Vasilis): Add assertion
-[[nodiscard]] uuid uuid::Create(void) noexcept
-{
-	uuid newone;
-	HRESULT hr = CoCreateGuid(&newone.mUUID);
-	return newone;
-}
-
-uuid::uuid(void) noexcept { memset(&mUUID, 0, sizeof(GUID)); }
-[[nodiscard]] bool uuid::operator==(const uuid& rhs) const noexcept { return memcmp(&mUUID, &rhs.mUUID, sizeof(GUID)) == 0; }
-[[nodiscard]] bool uuid::operator!=(const uuid& rhs) const noexcept { return memcmp(&mUUID, &rhs.mUUID, sizeof(GUID)) != 0; }
-[[nodiscard]] bool uuid::IsValid(void) const noexcept { return memcmp(&mUUID, &null, sizeof(GUID)) != 0; }
-
-//}
-
-[[nodiscard]] std::ostream& operator<<(std::ostream& lhs, const uuid& rhs)
-{
-	lhs << rhs.str();
-	return lhs;
-}
\ No newline at end of file
+//From https://github.com/VMormoris/GreenTea/blob/master/GreenTea/src/GreenTea/Core/uuid.cpp
+#include "uuid.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+	#include <Windows.h>
+	#include <bcrypt.h>
+	#pragma comment( lib, "bcrypt.lib" )
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+	#include <stdlib.h>
+#else
+	#include <cerrno>
+	#include <sys/random.h>
+#endif
+
+//Characters before each byte of the string, dashes go before the 4th, 6th, 8th and 10th byte
+static constexpr uint8_t sOffsets[16] = { 0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34 };
+
+//Value of every hex digit, 0xFF for everything else
+struct HexTable {
+	uint8_t Values[256];
+
+	constexpr HexTable(void) noexcept
+		: Values()
+	{
+		for (size_t i = 0; i < 256; i++)
+			Values[i] = 0xFF;
+		for (uint8_t i = 0; i < 10; i++)
+			Values['0' + i] = i;
+		for (uint8_t i = 0; i < 6; i++)
+		{
+			Values['A' + i] = 10 + i;
+			Values['a' + i] = 10 + i;
+		}
+	}
+};
+static constexpr HexTable sHex;
+static constexpr char sDigits[] = "0123456789ABCDEF";
+
+//namespace gte {
+
+[[nodiscard]] bool uuid::Parse(std::string_view str, uuid& id) noexcept
+{
+	if (str.size() < 36 || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-')
+		return false;
+
+	uint8_t bytes[16];
+	uint8_t invalid = 0;
+	for (size_t i = 0; i < 16; i++)
+	{
+		const uint8_t high = sHex.Values[(uint8_t)str[sOffsets[i]]];
+		const uint8_t low = sHex.Values[(uint8_t)str[sOffsets[i] + 1]];
+		invalid |= high | low;//Only 0xFF has the high bit set
+		bytes[i] = (uint8_t)(high << 4) | low;
+	}
+	if (invalid & 0x80)
+		return false;
+	memcpy(id.mBytes, bytes, sizeof(bytes));
+	return true;
+}
+
+uuid::uuid(const std::string& str) noexcept
+{
+	(void)Parse(str, *this);
+}
+
+void uuid::Format(char* out) const noexcept
+{
+	out[8] = out[13] = out[18] = out[23] = '-';
+	for (size_t i = 0; i < 16; i++)
+	{
+		out[sOffsets[i]] = sDigits[mBytes[i] >> 4];
+		out[sOffsets[i] + 1] = sDigits[mBytes[i] & 0xF];
+	}
+}
+
+[[nodiscard]] std::string uuid::str(void) const noexcept
+{
+	std::string str(36, '0');
+	Format(str.data());
+	return str;
+}
+
+//Fills data with bytes from the operating system's random source
+static void entropy(void* data, size_t size) noexcept
+{
+#ifdef _WIN32
+	if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, (PUCHAR)data, (ULONG)size, BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+	{
+		fprintf(stderr, "Couldn't get random bytes from the system\n");
+		exit(EXIT_FAILURE);
+	}
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+	arc4random_buf(data, size);
+#else
+	uint8_t* ptr = (uint8_t*)data;
+	while (size > 0)
+	{
+		const ssize_t count = getrandom(ptr, size, 0);
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count < 0)
+		{
+			fprintf(stderr, "Couldn't get random bytes from the system\n");
+			exit(EXIT_FAILURE);
+		}
+		ptr += count;
+		size -= (size_t)count;
+	}
+#endif
+}
+
+/**
+* @brief ChaCha20 (RFC 8439) keyed from the operating system, each block gives 4 identifiers
+* @details Asking the system for every identifier costs a call into the kernel, this takes one per 2^32 blocks
+*/
+class Generator {
+public:
+	Generator(void) noexcept { Rekey(); }
+
+	void Fill(uint8_t* out) noexcept
+	{
+		if (mUsed == sizeof(mBlock))
+			Refill();
+		memcpy(out, mBlock + mUsed, 16);
+		memset(mBlock + mUsed, 0, 16);//Handed out bytes aren't kept around
+		mUsed += 16;
+	}
+
+private:
+	void Rekey(void) noexcept
+	{
+		entropy(mKey, sizeof(mKey));
+		entropy(mNonce, sizeof(mNonce));
+		mCounter = 0;
+	}
+
+	static constexpr uint32_t rotl(uint32_t x, int n) noexcept { return (x << n) | (x >> (32 - n)); }
+	static constexpr void quarter(uint32_t* s, int a, int b, int c, int d) noexcept
+	{
+		s[a] += s[b]; s[d] = rotl(s[d] ^ s[a], 16);
+		s[c] += s[d]; s[b] = rotl(s[b] ^ s[c], 12);
+		s[a] += s[b]; s[d] = rotl(s[d] ^ s[a], 8);
+		s[c] += s[d]; s[b] = rotl(s[b] ^ s[c], 7);
+	}
+
+	void Refill(void) noexcept
+	{
+		const uint32_t input[16] = {
+			0x61707865, 0x3320646E, 0x79622D32, 0x6B206574,//"expand 32-byte k"
+			mKey[0], mKey[1], mKey[2], mKey[3], mKey[4], mKey[5], mKey[6], mKey[7],
+			mCounter, mNonce[0], mNonce[1], mNonce[2]
+		};
+		uint32_t state[16];
+		memcpy(state, input, sizeof(state));
+		for (int i = 0; i < 10; i++)
+		{
+			quarter(state, 0, 4, 8, 12); quarter(state, 1, 5, 9, 13); quarter(state, 2, 6, 10, 14); quarter(state, 3, 7, 11, 15);
+			quarter(state, 0, 5, 10, 15); quarter(state, 1, 6, 11, 12); quarter(state, 2, 7, 8, 13); quarter(state, 3, 4, 9, 14);
+		}
+		for (size_t i = 0; i < 16; i++)
+		{
+			const uint32_t word = state[i] + input[i];
+			mBlock[4 * i + 0] = (uint8_t)word;
+			mBlock[4 * i + 1] = (uint8_t)(word >> 8);
+			mBlock[4 * i + 2] = (uint8_t)(word >> 16);
+			mBlock[4 * i + 3] = (uint8_t)(word >> 24);
+		}
+		mUsed = 0;
+		if (++mCounter == 0)//Counter can't be reused with the same key
+			Rekey();
+	}
+
+	uint32_t mKey[8];
+	uint32_t mNonce[3];
+	uint32_t mCounter = 0;
+	uint8_t mBlock[64];
+	size_t mUsed = sizeof(mBlock);
+};
+
+[[nodiscard]] uuid uuid::Create(void) noexcept
+{
+	thread_local Generator generator;
+	uuid newone;
+	generator.Fill(newone.mBytes);
+	newone.mBytes[6] = (newone.mBytes[6] & 0x0F) | 0x40;//Version 4
+	newone.mBytes[8] = (newone.mBytes[8] & 0x3F) | 0x80;//Variant 1
+	return newone;
+}
+
+/**
+* @brief SHA-1 (FIPS 180-4) of the namespace followed by the name
+*/
+static void sha1(const uint8_t* ns, std::string_view name, uint8_t* digest) noexcept
+{
+	uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+	const auto rotl = [](uint32_t x, int n) { return (x << n) | (x >> (32 - n)); };
+	const auto compress = [&](const uint8_t* block)
+	{
+		uint32_t w[80];
+		for (int i = 0; i < 16; i++)
+			w[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16 | (uint32_t)block[4 * i + 2] << 8 | block[4 * i + 3];
+		for (int i = 16; i < 80; i++)
+			w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+		uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+		for (int i = 0; i < 80; i++)
+		{
+			uint32_t f, k;
+			if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+			else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+			else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+			else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+			const uint32_t temp = rotl(a, 5) + f + e + k + w[i];
+			e = d; d = c; c = rotl(b, 30); b = a; a = temp;
+		}
+		h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+	};
+
+	//Namespace and name are streamed through a single block buffer, then padding and the length in bits
+	uint8_t block[64];
+	size_t used = 0;
+	const auto append = [&](const uint8_t* data, size_t size)
+	{
+		while (size > 0)
+		{
+			const size_t count = size < 64 - used ? size : 64 - used;
+			memcpy(block + used, data, count);
+			used += count;
+			data += count;
+			size -= count;
+			if (used == 64)
+			{
+				compress(block);
+				used = 0;
+			}
+		}
+	};
+	append(ns, 16);
+	append((const uint8_t*)name.data(), name.size());
+
+	const uint64_t bits = (16 + (uint64_t)name.size()) * 8;
+	const uint8_t one = 0x80;
+	append(&one, 1);
+	const uint8_t zero = 0;
+	while (used != 56)
+		append(&zero, 1);
+	uint8_t length[8];
+	for (int i = 0; i < 8; i++)
+		length[i] = (uint8_t)(bits >> (56 - 8 * i));
+	append(length, 8);
+
+	for (int i = 0; i < 5; i++)
+	{
+		digest[4 * i + 0] = (uint8_t)(h[i] >> 24);
+		digest[4 * i + 1] = (uint8_t)(h[i] >> 16);
+		digest[4 * i + 2] = (uint8_t)(h[i] >> 8);
+		digest[4 * i + 3] = (uint8_t)h[i];
+	}
+}
+
+[[nodiscard]] uuid uuid::FromName(const uuid& ns, std::string_view name) noexcept
+{
+	uint8_t digest[20];
+	sha1(ns.mBytes, name, digest);
+	uuid id;
+	memcpy(id.mBytes, digest, sizeof(id.mBytes));
+	id.mBytes[6] = (id.mBytes[6] & 0x0F) | 0x50;//Version 5
+	id.mBytes[8] = (id.mBytes[8] & 0x3F) | 0x80;//Variant 1
+	return id;
+}
+
+static constexpr uint8_t null[16] = { 0 };
+[[nodiscard]] bool uuid::operator==(const uuid& rhs) const noexcept { return memcmp(mBytes, rhs.mBytes, sizeof(mBytes)) == 0; }
+[[nodiscard]] bool uuid::operator!=(const uuid& rhs) const noexcept { return memcmp(mBytes, rhs.mBytes, sizeof(mBytes)) != 0; }
+[[nodiscard]] bool uuid::IsValid(void) const noexcept { return memcmp(mBytes, null, sizeof(mBytes)) != 0; }
+
+//}
+
+[[nodiscard]] std::ostream& operator<<(std::ostream& lhs, const uuid& rhs)
+{
+	char str[36];
+	rhs.Format(str);
+	lhs.write(str, sizeof(str));
+	return lhs;
+}
+
+[[nodiscard]] size_t std::hash<uuid>::operator()(const uuid& id) const
+{
+	//Bytes are already random (or a digest), folding them is enough
+	uint64_t halves[2];
+	memcpy(halves, id.mBytes, sizeof(halves));
+	return (size_t)(halves[0] ^ (halves[1] * 0x9E3779B97F4A7C15ull));
+}
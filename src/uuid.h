@@ -1,82 +1,105 @@
-//From https://github.com/VMormoris/GreenTea/blob/master/GreenTea/src/GreenTea/Core/uuid.h
-#pragma once
-
-#include <string>
-#include <ostream>
-
-#include <combaseapi.h>
-#pragma comment( lib, "rpcrt4.lib" )
-
-//namespace gte {
-
-	/**
-	* @brief Universal unique identifier of 128 bits
-	* @details We are using the native API calls of each Platform to produce the number. By default a new uuid is "invalid",
-	*	use the Create() function in order to create a new unique identifier:
-	*
-	* @code{.cpp}
-	* uuid ID = uuid::Create();
-	* @endcode
-	*/
-class uuid {
-	//TODO(Vasilis): Add assingement operator for std::string as rhs
-public:
-
-	/**
-	* @brief Constructs an "invalid" uuid
-	* @details An "invalid" uuid is efectively 128 bits of zeros
-	*/
-	uuid(void) noexcept;
-
-	//Defaults
-	~uuid(void) = default;
-	uuid(const uuid&) = default;
-	uuid(uuid&&) = default;
-	[[nodiscard]] uuid& operator=(const uuid&) = default;
-	[[nodiscard]] uuid& operator=(uuid&&) = default;
-
-	/**
-	* @brief Constructs a unique identifier from the given string
-	* @param str The string from which the uuid will be extracted from
-	*/
-	uuid(const std::string& str) noexcept;
-
-	/**
-	* @brief Gets the hexadecimal representation of the uuid as string
-	* @return A string with the representation of the uuid
-	*/
-	[[nodiscard]] std::string str(void) const noexcept;
-
-	/**
-	* @brief Creates a new unique identifier
-	* @return A uuid
-	*/
-	[[nodiscard]] static uuid Create(void) noexcept;
-
-	/**
-	* @brief Checks whether the identifier is "valid" or not
-	* @return True if uuid it's trully a unique identifier, false otherwise
-	*/
-	[[nodiscard]] bool IsValid(void) const noexcept;
-
-	//Comparison operators
-	[[nodiscard]] bool operator==(const uuid& rhs) const noexcept;
-	[[nodiscard]] bool operator!=(const uuid& lhs) const noexcept;
-
-private:
-	GUID mUUID;
-	friend struct std::hash<uuid>;
-};
-
-//}
-
-//We need to be able to print it
-std::ostream& operator<<(std::ostream& lhs, const uuid& rhs);
-
-namespace std {
-	template<>
-	struct hash<uuid> {
-		[[nodiscard]] size_t operator()(const uuid& id) const;
-	};
-
-}
\ No newline at end of file
+//From https://github.com/VMormoris/GreenTea/blob/master/GreenTea/src/GreenTea/Core/uuid.h
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <ostream>
+
+//namespace gte {
+
+	/**
+	* @brief Universal unique identifier of 128 bits
+	* @details By default a new uuid is "invalid", use the Create() function in order to create a new random
+	*	identifier (version 4) or FromName() for one that is always the same for the same name (version 5):
+	*
+	* @code{.cpp}
+	* uuid ID = uuid::Create();
+	* uuid Same = uuid::FromName(Namespace, "Scripts/Player.gtcomp");
+	* @endcode
+	*
+	*	Bytes are kept in the order they are written, so the string is the same as the one of the Windows' GUID
+	*	that was used before (e.g. "6BA7B810-9DAD-11D1-80B4-00C04FD430C8").
+	*/
+class uuid {
+	//TODO(Vasilis): Add assingement operator for std::string as rhs
+public:
+
+	/**
+	* @brief Constructs an "invalid" uuid
+	* @details An "invalid" uuid is efectively 128 bits of zeros
+	*/
+	uuid(void) noexcept = default;
+
+	//Defaults
+	~uuid(void) = default;
+	uuid(const uuid&) = default;
+	uuid(uuid&&) = default;
+	uuid& operator=(const uuid&) = default;
+	uuid& operator=(uuid&&) = default;
+
+	/**
+	* @brief Constructs a unique identifier from the given string
+	* @param str The string from which the uuid will be extracted from, the uuid is "invalid" if it can't be parsed
+	*/
+	uuid(const std::string& str) noexcept;
+
+	/**
+	* @brief Parses the first 36 characters of str, hex digits can be either upper or lower case
+	* @return False if str doesn't start with an identifier, id is left untouched then
+	*/
+	[[nodiscard]] static bool Parse(std::string_view str, uuid& id) noexcept;
+
+	/**
+	* @brief Gets the hexadecimal representation of the uuid as string
+	* @return A string with the representation of the uuid
+	*/
+	[[nodiscard]] std::string str(void) const noexcept;
+
+	/**
+	* @brief Writes the hexadecimal representation (upper case) on 36 characters, without a null terminator
+	*/
+	void Format(char* out) const noexcept;
+
+	/**
+	* @brief Creates a new random identifier (version 4)
+	* @details Bytes come from ChaCha20 that is keyed from the operating system's random source, one generator per thread.
+	* @return A uuid
+	*/
+	[[nodiscard]] static uuid Create(void) noexcept;
+
+	/**
+	* @brief Creates the identifier of a name on the given namespace (version 5, SHA-1 based)
+	* @details The same name always gives the same identifier, so things that are generated again keep their ids
+	*/
+	[[nodiscard]] static uuid FromName(const uuid& ns, std::string_view name) noexcept;
+
+	/**
+	* @brief Checks whether the identifier is "valid" or not
+	* @return True if uuid it's trully a unique identifier, false otherwise
+	*/
+	[[nodiscard]] bool IsValid(void) const noexcept;
+
+	[[nodiscard]] const uint8_t* Bytes(void) const noexcept { return mBytes; }
+
+	//Comparison operators
+	[[nodiscard]] bool operator==(const uuid& rhs) const noexcept;
+	[[nodiscard]] bool operator!=(const uuid& lhs) const noexcept;
+
+private:
+	uint8_t mBytes[16] = { 0 };
+	friend struct std::hash<uuid>;
+};
+
+//}
+
+//We need to be able to print it
+std::ostream& operator<<(std::ostream& lhs, const uuid& rhs);
+
+namespace std {
+	template<>
+	struct hash<uuid> {
+		[[nodiscard]] size_t operator()(const uuid& id) const;
+	};
+
+}
@@ -0,0 +1,152 @@
+//Local stand-in for the notification server of GreenTea Engine
+//Accepts connections on the same endpoint as the Engine, prints every message and answers with "Ok".
+//Usage: gtserver [-endpoint=<path>] [-count=<messages before exiting>] [-delay=<ms before answering>] [-reply=<answer>]
+//       gtserver [-endpoint=<path>] [-timeout=<ms>] -send=<message>   Sends a message the same way gtreflect does
+#include "../../src/Transport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+	#define NOMINMAX
+	#include <Windows.h>
+#else
+	#include <csignal>
+	#include <sys/socket.h>
+	#include <sys/un.h>
+	#include <unistd.h>
+#endif
+
+struct ServerOptions {
+	std::string Endpoint = Transport::DefaultEndpoint();
+	std::string Reply = "Ok";
+	std::string Send;//Run as client instead
+	size_t Count = 0;//0 runs forever
+	size_t Delay = 0;
+	size_t Timeout = 2000;
+};
+
+static void answer(const ServerOptions& options, const std::string& msg) noexcept
+{
+	printf("Received: %s\n", msg.c_str());
+	fflush(stdout);
+	if (options.Delay)
+		std::this_thread::sleep_for(std::chrono::milliseconds(options.Delay));
+}
+
+#ifdef _WIN32
+
+static int serve(const ServerOptions& options) noexcept
+{
+	for (size_t served = 0; options.Count == 0 || served < options.Count; served++)
+	{
+		HANDLE pipe = CreateNamedPipeA(options.Endpoint.c_str(), PIPE_ACCESS_DUPLEX, PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT, 1, 1024, 1024, 0, nullptr);
+		if (pipe == INVALID_HANDLE_VALUE)
+		{
+			fprintf(stderr, "Couldn't create pipe: %s\n", options.Endpoint.c_str());
+			return EXIT_FAILURE;
+		}
+		if (ConnectNamedPipe(pipe, nullptr) || GetLastError() == ERROR_PIPE_CONNECTED)
+		{
+			char buffer[1024];
+			DWORD bytes = 0;
+			if (ReadFile(pipe, buffer, sizeof(buffer) - 1, &bytes, nullptr))
+			{
+				buffer[bytes] = '\0';
+				answer(options, buffer);
+				WriteFile(pipe, options.Reply.c_str(), (DWORD)options.Reply.size() + 1, &bytes, nullptr);
+				FlushFileBuffers(pipe);
+			}
+		}
+		DisconnectNamedPipe(pipe);
+		CloseHandle(pipe);
+	}
+	return EXIT_SUCCESS;
+}
+
+#else
+
+static int serve(const ServerOptions& options) noexcept
+{
+	signal(SIGPIPE, SIG_IGN);
+
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	if (options.Endpoint.size() >= sizeof(address.sun_path))
+	{
+		fprintf(stderr, "Endpoint path is too long: %s\n", options.Endpoint.c_str());
+		return EXIT_FAILURE;
+	}
+	options.Endpoint.copy(address.sun_path, options.Endpoint.size());
+
+	const int server = socket(AF_UNIX, SOCK_STREAM, 0);
+	unlink(options.Endpoint.c_str());
+	if (server < 0 || bind(server, (const sockaddr*)&address, sizeof(address)) != 0 || listen(server, 8) != 0)
+	{
+		fprintf(stderr, "Couldn't listen on: %s\n", options.Endpoint.c_str());
+		return EXIT_FAILURE;
+	}
+	printf("Listening on: %s\n", options.Endpoint.c_str());
+	fflush(stdout);
+
+	for (size_t served = 0; options.Count == 0 || served < options.Count; served++)
+	{
+		const int client = accept(server, nullptr, nullptr);
+		if (client < 0)
+			continue;
+
+		std::string msg;
+		char buffer[1024];
+		ssize_t bytes = 0;
+		while (msg.find('\0') == std::string::npos && (bytes = recv(client, buffer, sizeof(buffer), 0)) > 0)
+			msg.append(buffer, (size_t)bytes);
+		msg.resize(std::min(msg.size(), msg.find('\0')));
+
+		answer(options, msg);
+		send(client, options.Reply.c_str(), options.Reply.size() + 1, 0);
+		close(client);
+	}
+
+	close(server);
+	unlink(options.Endpoint.c_str());
+	return EXIT_SUCCESS;
+}
+
+#endif
+
+int main(int argc, const char** argv)
+{
+	ServerOptions options;
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg{ argv[i] };
+		if (arg.substr(0, 10).compare("-endpoint=") == 0)
+			options.Endpoint = arg.substr(10);
+		else if (arg.substr(0, 7).compare("-count=") == 0)
+			options.Count = std::stoull(arg.substr(7));
+		else if (arg.substr(0, 7).compare("-delay=") == 0)
+			options.Delay = std::stoull(arg.substr(7));
+		else if (arg.substr(0, 7).compare("-reply=") == 0)
+			options.Reply = arg.substr(7);
+		else if (arg.substr(0, 6).compare("-send=") == 0)
+			options.Send = arg.substr(6);
+		else if (arg.substr(0, 9).compare("-timeout=") == 0)
+			options.Timeout = std::stoull(arg.substr(9));
+		else
+		{
+			fprintf(stderr, "Not valid argument: %s.\n", argv[i]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (options.Send.empty())
+		return serve(options);
+
+	static constexpr const char* sStatus[] = { "Ok", "NotRunning", "Timeout", "Failed" };
+	const TransportStatus status = Notify(options.Endpoint, options.Send, std::chrono::milliseconds(options.Timeout));
+	printf("%s\n", sStatus[(int)status]);
+	return status == TransportStatus::Ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}